@@ -0,0 +1,356 @@
+/**
+ * @file deck_bench.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Microbenchmarks of the Deck, PlayingCard and WarCardGame hot paths, with machine readable output.
+ *
+ * Times:
+ *  - Deck::shuffle (eager, parallel, and lazy followed by a five card deal), Deck::sample, Deck::deal_card,
+ *    Deck::assign and Deck::contents, for decks of 52 to 10^7 cards
+ *  - buildStandardDeck and PlayingCard::str
+ *  - constructing a Deck without a seed
+ *  - full silent games of War, and turns of two-player SilentWarCardGame and 2 to 8 player WarGame
+ *
+ * Usage: deck_bench [csv|json] [max deck size]
+ *
+ * Prints one result per benchmark and deck size, as CSV (the default) or JSON, so results can be saved and
+ * compared to find regressions. Each result has the deck size, the number of operations timed, the
+ * nanoseconds per operation, and the nanoseconds per card handled (item). Each benchmark repeats until it has
+ * run for at least kMinTime. A War game is one operation and one item, and in the per-turn benchmarks a turn is
+ * one operation and one item.
+ */
+
+#include "deck.h"
+#include "parallel_shuffle.h"
+#include "playing_card.h"
+#include "thread_pool.h"
+#include "trace_writer.h"
+#include "war_game.h"
+#include "war_simulator.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+const std::chrono::nanoseconds kMinTime = std::chrono::milliseconds(200); /**<@brief Minimum time per benchmark */
+
+/**
+ * @brief Result of one benchmark
+ */
+struct BenchResult
+{
+    std::string name; /**<@brief Benchmark name */
+    std::size_t size; /**<@brief Deck size */
+    std::size_t itemsPerOperation; /**<@brief Cards handled per operation */
+    unsigned long long operations; /**<@brief Number of operations timed */
+    double totalNs; /**<@brief Total time of the timed operations */
+};
+
+/** @brief Values written here cannot be optimized away */
+volatile std::uint64_t gSink = 0;
+
+/**
+ * @brief Times an operation, repeating it until at least kMinTime has passed
+ * @param[in] name Benchmark name
+ * @param[in] size Deck size
+ * @param[in] itemsPerOperation Cards handled per operation
+ * @param[in] operation Callable run once per repetition. It returns the time of the part to count, so setup
+ * inside it can be left out of the result.
+ * @param[in] operationsPerCall Operations performed by each call
+ */
+template <class Operation>
+BenchResult measure(const std::string& name, std::size_t size, std::size_t itemsPerOperation, Operation operation,
+        unsigned long long operationsPerCall = 1)
+{
+    BenchResult result{name, size, itemsPerOperation, 0, 0.0};
+    std::chrono::nanoseconds timed(0);
+    while (timed < kMinTime)
+    {
+        timed += operation();
+        result.operations += operationsPerCall;
+    }
+    result.totalNs = static_cast<double>(timed.count());
+    return result;
+}
+
+/**
+ * @brief Times a block of code, returning its duration
+ */
+template <class Block>
+std::chrono::nanoseconds timeBlock(Block block)
+{
+    const auto start = Clock::now();
+    block();
+    return Clock::now() - start;
+}
+
+std::vector<int> sequence(std::size_t size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+void benchDeck(std::vector<BenchResult>& results, std::size_t size)
+{
+    const std::vector<int> values = sequence(size);
+    doc::Deck<int> deck(values);
+    deck.seed(1);
+
+    results.push_back(measure("Deck::shuffle", size, size, [&]()
+    {
+        return timeBlock([&]() { deck.shuffle(); });
+    }));
+
+    // Parallel shuffle on one thread per hardware thread, for the sizes it is meant for
+    if (size >= doc::ParallelPolicy().minParallelSize)
+    {
+        doc::ThreadPool pool;
+        results.push_back(measure("Deck::shuffle parallel", size, size, [&]()
+        {
+            return timeBlock([&]() { deck.shuffle(doc::ParallelPolicy{0, &pool}); });
+        }));
+    }
+
+    // A lazy shuffle followed by a five card deal only pays for the five cards. The deck is refilled, untimed,
+    // when it runs low.
+    doc::Deck<int> lazyDeck(values);
+    lazyDeck.seed(1);
+    lazyDeck.setShuffleMode(doc::ShuffleMode::Lazy);
+    results.push_back(measure("Deck::shuffle lazy + deal 5", size, 5, [&]()
+    {
+        if (lazyDeck.size() < 5)
+            lazyDeck.assign(values);
+        return timeBlock([&]()
+        {
+            lazyDeck.shuffle();
+            std::uint64_t sum = 0;
+            for (int card = 0; card < 5; card++)
+                sum += lazyDeck.deal_card();
+            gSink = sum;
+        });
+    }));
+
+    // A random hand of five, without shuffling the deck
+    results.push_back(measure("Deck::sample 5", size, 5, [&]()
+    {
+        return timeBlock([&]()
+        {
+            int hand[5];
+            deck.sample(5, hand);
+            gSink = hand[0];
+        });
+    }));
+
+    results.push_back(measure("Deck::deal_card", size, 1, [&]()
+    {
+        deck.assign(values);
+        return timeBlock([&]()
+        {
+            std::uint64_t sum = 0;
+            while (!deck.empty())
+                sum += deck.deal_card();
+            gSink = sum;
+        });
+    }, size));
+
+    results.push_back(measure("Deck::assign", size, size, [&]()
+    {
+        return timeBlock([&]() { deck.assign(values); });
+    }));
+
+    results.push_back(measure("Deck::contents", size, size, [&]()
+    {
+        return timeBlock([&]() { gSink = deck.contents().size(); });
+    }));
+}
+
+void benchPlayingCard(std::vector<BenchResult>& results)
+{
+    results.push_back(measure("buildStandardDeck", 52, 52, [&]()
+    {
+        return timeBlock([&]() { gSink = doc::buildStandardDeck().size(); });
+    }));
+
+    const std::vector<doc::PlayingCard> cards = doc::buildStandardDeck();
+    results.push_back(measure("PlayingCard::str", cards.size(), 1, [&]()
+    {
+        return timeBlock([&]()
+        {
+            std::size_t length = 0;
+            for (const auto& card : cards)
+                length += card.str().size();
+            gSink = length;
+        });
+    }, cards.size()));
+}
+
+void benchSeeding(std::vector<BenchResult>& results)
+{
+    // Decks constructed without a seed are seeded from the thread's SeedStream, not std::random_device
+    const std::vector<int> values = sequence(52);
+    results.push_back(measure("Deck unseeded construct", values.size(), values.size(), [&]()
+    {
+        return timeBlock([&]()
+        {
+            doc::Deck<int> deck(values);
+            gSink = deck.size();
+        });
+    }));
+}
+
+void benchWar(std::vector<BenchResult>& results)
+{
+    const doc::WarSimulator simulator;
+    std::uint64_t game = 0;
+    results.push_back(measure("SilentWarCardGame", 52, 1, [&]()
+    {
+        return timeBlock([&]()
+        {
+            gSink = simulator.playGame(doc::WarSimulator::gameSeed(1, game++)).turns;
+        });
+    }));
+}
+
+/**
+ * @brief Times whole games, counting each turn played as an operation
+ * @param[in] name Benchmark name
+ * @param[in] playGame Callable that plays the game with the seed it is passed, and returns its turns played
+ */
+template <class PlayGame>
+BenchResult measureTurns(const std::string& name, PlayGame playGame)
+{
+    BenchResult result{name, 52, 1, 0, 0.0};
+    std::chrono::nanoseconds timed(0);
+    std::uint64_t seed = 0;
+    while (timed < kMinTime)
+    {
+        unsigned long long turns = 0;
+        timed += timeBlock([&]()
+        {
+            turns = playGame(seed++);
+        });
+        result.operations += turns;
+    }
+    result.totalNs = static_cast<double>(timed.count());
+    return result;
+}
+
+template <std::size_t NPlayers>
+void benchWarGameTurns(std::vector<BenchResult>& results, const std::vector<doc::PlayingCard>& cards)
+{
+    results.push_back(measureTurns("WarGame<" + std::to_string(NPlayers) + "> turn", [&](std::uint64_t seed)
+    {
+        doc::WarGame<NPlayers> game(cards, seed);
+        game.autoPlay();
+        return game.turnsPlayed();
+    }));
+}
+
+void benchWarTurns(std::vector<BenchResult>& results)
+{
+    const std::vector<doc::PlayingCard> cards = doc::buildStandardDeck();
+    results.push_back(measureTurns("SilentWarCardGame turn", [&](std::uint64_t seed)
+    {
+        doc::SilentWarCardGame game(cards, seed);
+        while (!game.gameOver())
+            game.playTurn();
+        return game.turnsPlayed();
+    }));
+    results.push_back(measureTurns("StaticWarCardGame turn", [&](std::uint64_t seed)
+    {
+        doc::StaticWarCardGame<> game(cards, seed);
+        while (!game.gameOver())
+            game.playTurn();
+        return game.turnsPlayed();
+    }));
+
+    // Full per-turn logging, to /dev/null so only the cost of formatting and writing is measured
+    std::ofstream devNull("/dev/null");
+    results.push_back(measureTurns("TextWarSink logged turn", [&](std::uint64_t seed)
+    {
+        doc::WarCardGame game(cards, seed, doc::TextWarSink(devNull));
+        game.autoPlay();
+        return game.turnsPlayed();
+    }));
+    doc::TraceWriter writer(std::string("/dev/null"));
+    results.push_back(measureTurns("TraceWarSink logged turn", [&](std::uint64_t seed)
+    {
+        doc::BasicWarCardGame<doc::TraceWarSink> game(cards, seed, doc::TraceWarSink(writer));
+        game.autoPlay();
+        return game.turnsPlayed();
+    }));
+    benchWarGameTurns<2>(results, cards);
+    benchWarGameTurns<3>(results, cards);
+    benchWarGameTurns<4>(results, cards);
+    benchWarGameTurns<6>(results, cards);
+    benchWarGameTurns<8>(results, cards);
+}
+
+void printCsv(const std::vector<BenchResult>& results)
+{
+    std::cout << "benchmark,size,operations,ns_per_op,ns_per_item,ops_per_second\n";
+    for (const auto& result : results)
+    {
+        const double nsPerOp = result.totalNs / result.operations;
+        std::cout << result.name << "," << result.size << "," << result.operations << "," << nsPerOp << "," <<
+            nsPerOp / result.itemsPerOperation << "," << 1e9 / nsPerOp << "\n";
+    }
+}
+
+void printJson(const std::vector<BenchResult>& results)
+{
+    std::cout << "[\n";
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        const auto& result = results[i];
+        const double nsPerOp = result.totalNs / result.operations;
+        std::cout << "  {\"benchmark\": \"" << result.name << "\", \"size\": " << result.size <<
+            ", \"operations\": " << result.operations << ", \"ns_per_op\": " << nsPerOp <<
+            ", \"ns_per_item\": " << nsPerOp / result.itemsPerOperation << ", \"ops_per_second\": " <<
+            1e9 / nsPerOp << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    std::cout << "]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string format = argc > 1 ? argv[1] : "csv";
+    const std::size_t maxSize = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000000;
+    if (format != "csv" && format != "json")
+    {
+        std::cerr << "Usage: deck_bench [csv|json] [max deck size]\n";
+        return 1;
+    }
+
+    std::vector<BenchResult> results;
+    for (const std::size_t size : {std::size_t(52), std::size_t(1000), std::size_t(100000), std::size_t(10000000)})
+    {
+        if (size <= maxSize)
+            benchDeck(results, size);
+    }
+    benchPlayingCard(results);
+    benchSeeding(results);
+    benchWar(results);
+    benchWarTurns(results);
+
+    if (format == "json")
+        printJson(results);
+    else
+        printCsv(results);
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file bounded_random.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare BoundedRandom class, that draws unbiased random integers in a range from any random number
+ * generator, for use by the shuffle algorithms.
+ */
+
+#ifndef BOUNDED_RANDOM_H
+#define BOUNDED_RANDOM_H
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+namespace detail
+{
+
+/**
+ * @brief Returns the high and low 64 bits of the 128-bit product of two 64-bit values
+ */
+inline std::uint64_t multiplyHigh(std::uint64_t a, std::uint64_t b, std::uint64_t& low)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    low = static_cast<std::uint64_t>(product);
+    return static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t aLow = a & 0xffffffffULL;
+    const std::uint64_t aHigh = a >> 32;
+    const std::uint64_t bLow = b & 0xffffffffULL;
+    const std::uint64_t bHigh = b >> 32;
+    const std::uint64_t lowLow = aLow * bLow;
+    const std::uint64_t highLow = aHigh * bLow;
+    const std::uint64_t lowHigh = aLow * bHigh;
+    const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xffffffffULL) + lowHigh;
+    low = (middle << 32) | (lowLow & 0xffffffffULL);
+    return aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @class BoundedRandom "bounded_random.h" "bounded_random.h"
+ *
+ * @brief Draws unbiased random integers in [0, range) from a UniformRandomBitGenerator, using Lemire's
+ * nearly divisionless method (https://arxiv.org/abs/1805.10941). A division is only needed in the rare case
+ * the first draw falls in the biased region.
+ *
+ * Random words are drawn from the generator in batches: a generator producing 64-bit values supplies two
+ * 32-bit draws per value, so shuffling a deck smaller than 2^32 needs one generator call per two cards.
+ * Generators producing exactly 32 bits are used directly, and any other generator goes through
+ * std::uniform_int_distribution.
+ *
+ * Holds a reference to the generator, which must outlive it.
+ */
+template <class Rng>
+class BoundedRandom
+{
+    public:
+
+        /**
+         * @brief Construct with the generator to draw from
+         * @param[in] randomGenerator Generator, which is assumed to be seeded appropriately
+         */
+        explicit BoundedRandom(Rng& randomGenerator) : mRandomGen(randomGenerator) {}
+
+        /**
+         * @brief Returns a uniformly distributed integer in [0, range)
+         * @param[in] range Number of possible values, must be greater than 0
+         */
+        std::uint32_t below(std::uint32_t range)
+        {
+            return fromBits(next32(), range);
+        }
+
+        /**
+         * @brief Returns two uniformly distributed integers, in [0, firstRange) and [0, secondRange), from a
+         * single 64-bit random value
+         * @param[in] firstRange Number of possible values of the first integer, must be greater than 0
+         * @param[in] secondRange Number of possible values of the second integer, must be greater than 0
+         * @param[out] first First integer
+         * @param[out] second Second integer
+         */
+        void below(std::uint32_t firstRange, std::uint32_t secondRange, std::uint32_t& first, std::uint32_t& second)
+        {
+            const std::uint64_t word = next64();
+            first = fromBits(static_cast<std::uint32_t>(word), firstRange);
+            second = fromBits(static_cast<std::uint32_t>(word >> 32), secondRange);
+        }
+
+        /**
+         * @brief Returns a uniformly distributed integer in [0, range)
+         * @param[in] range Number of possible values, must be greater than 0
+         */
+        std::uint64_t below(std::uint64_t range)
+        {
+            if (range <= std::numeric_limits<std::uint32_t>::max())
+                return below(static_cast<std::uint32_t>(range));
+
+            std::uint64_t low;
+            std::uint64_t high = detail::multiplyHigh(next64(), range, low);
+            if (low < range)
+            {
+                const std::uint64_t threshold = (0ULL - range) % range;
+                while (low < threshold)
+                    high = detail::multiplyHigh(next64(), range, low);
+            }
+            return high;
+        }
+
+        /**
+         * @brief Forget any random bits saved from the generator, so the next draw starts from its current state.
+         * Call after re-seeding the generator, so draws are reproducible from the seed.
+         */
+        void reset() { mHalfReady = false; }
+
+        /**
+         * @brief Take the random bits saved by another BoundedRandom, such as one drawing from a generator that
+         * has been moved into this one's
+         */
+        void takeSaved(const BoundedRandom& other)
+        {
+            mSavedHalf = other.mSavedHalf;
+            mHalfReady = other.mHalfReady;
+        }
+
+    private:
+
+        /**
+         * @brief Map 32 random bits to [0, range), drawing more bits in the rare case they would be biased
+         */
+        std::uint32_t fromBits(std::uint32_t bits, std::uint32_t range)
+        {
+            std::uint64_t product = static_cast<std::uint64_t>(bits) * range;
+            std::uint32_t low = static_cast<std::uint32_t>(product);
+            if (low < range)
+            {
+                const std::uint32_t threshold = (0u - range) % range;
+                while (low < threshold)
+                {
+                    product = static_cast<std::uint64_t>(next32()) * range;
+                    low = static_cast<std::uint32_t>(product);
+                }
+            }
+            return static_cast<std::uint32_t>(product >> 32);
+        }
+
+        static constexpr std::uint64_t kSpan = static_cast<std::uint64_t>(Rng::max() - Rng::min());
+
+        /**
+         * @brief Returns 32 uniformly distributed random bits
+         */
+        std::uint32_t next32()
+        {
+            if (kSpan == std::numeric_limits<std::uint64_t>::max())
+            {
+                // Use each half of a 64-bit value in turn
+                if (mHalfReady)
+                {
+                    mHalfReady = false;
+                    return mSavedHalf;
+                }
+                const std::uint64_t word = static_cast<std::uint64_t>(mRandomGen() - Rng::min());
+                mSavedHalf = static_cast<std::uint32_t>(word >> 32);
+                mHalfReady = true;
+                return static_cast<std::uint32_t>(word);
+            }
+            else if (kSpan == std::numeric_limits<std::uint32_t>::max())
+                return static_cast<std::uint32_t>(mRandomGen() - Rng::min());
+            else
+                return std::uniform_int_distribution<std::uint32_t>()(mRandomGen);
+        }
+
+        /**
+         * @brief Returns 64 uniformly distributed random bits
+         */
+        std::uint64_t next64()
+        {
+            if (kSpan == std::numeric_limits<std::uint64_t>::max())
+                return static_cast<std::uint64_t>(mRandomGen() - Rng::min());
+            else
+                return (static_cast<std::uint64_t>(next32()) << 32) | next32();
+        }
+
+        Rng& mRandomGen; /**<@brief Generator to draw from */
+        std::uint32_t mSavedHalf = 0; /**<@brief Unused upper half of the last 64-bit value */
+        bool mHalfReady = false; /**<@brief If mSavedHalf has not been used yet */
+
+};
+
+} // namespace doc
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file compact_card.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare CompactCard class, a one byte encoding of a PlayingCard.
+ *
+ */
+
+#ifndef COMPACT_CARD_H
+#define COMPACT_CARD_H
+
+#include "playing_card.h"
+#include <cstdint>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+namespace detail
+{
+
+/**
+ * @brief Lookup tables from a CompactCard's id to its rank, suite and strength in War.
+ *
+ * Filled in at compile time.
+ */
+struct CompactCardTables
+{
+    PlayingCard::Rank rank[52]; /**<@brief Rank of each id */
+    PlayingCard::Suite suite[52]; /**<@brief Suite of each id */
+    std::uint8_t warStrength[52]; /**<@brief Strength of each id in War, 2 to 14 (Ace high) */
+
+    constexpr CompactCardTables() : rank(), suite(), warStrength()
+    {
+        for (int id = 0; id < 52; id++)
+        {
+            const int rankValue = id % 13 + 1; // Ace low
+            rank[id] = static_cast<PlayingCard::Rank>(rankValue);
+            suite[id] = static_cast<PlayingCard::Suite>(id / 13);
+            warStrength[id] = static_cast<std::uint8_t>(rankValue == 1 ? 14 : rankValue);
+        }
+    }
+};
+
+constexpr CompactCardTables kCompactCardTables{};
+
+} // namespace detail
+
+/**
+ * @class CompactCard "compact_card.h" "compact_card.h"
+ *
+ * @brief A playing card of a standard 52-card deck, stored in a single byte.
+ *
+ * The card's id is suite * 13 + (rank - 1), so ids 0 to 12 are the Ace to King of Clubs, 13 to 25 the Ace
+ * to King of Diamonds, and so on. The rank, suite and War strength of a card are read from constexpr
+ * tables, so comparing two cards in War is a single table lookup each, with no special case for Aces.
+ *
+ * A CompactCard converts to and from a PlayingCard without loss. Use it where many cards are stored and
+ * compared, such as simulating games, and PlayingCard where cards are shown to people.
+ */
+class CompactCard
+{
+    public:
+
+        static constexpr int kIdCount = 52; /**<@brief Number of card ids, 0 to 51 */
+
+        /**
+         * @brief Construct the Ace of Clubs (id 0)
+         */
+        constexpr CompactCard() : mId(0) {}
+
+        /**
+         * @brief Construct card from its id
+         * @param[in] id Card id, 0 to 51
+         */
+        constexpr explicit CompactCard(std::uint8_t id) : mId(id) {}
+
+        /**
+         * @brief Construct card with suite and rank
+         * @param[in] suite One of four suites
+         * @param[in] rank One of thirteen ranks
+         */
+        constexpr CompactCard(const PlayingCard::Suite suite, const PlayingCard::Rank rank) :
+            mId(static_cast<std::uint8_t>(static_cast<int>(suite) * 13 + static_cast<int>(rank) - 1))
+        {
+        }
+
+        /**
+         * @brief Construct card with the same suite and rank as a PlayingCard
+         * @param[in] card Card to convert
+         */
+        constexpr explicit CompactCard(const PlayingCard& card) : CompactCard(card.suite(), card.rank()) {}
+
+        /**
+         * @brief Returns the card's id
+         * @return Id, 0 to 51
+         */
+        constexpr std::uint8_t id() const { return mId; }
+
+        /**
+         * @brief Returns the card's suite
+         * @return suite
+         */
+        constexpr PlayingCard::Suite suite() const { return detail::kCompactCardTables.suite[mId]; }
+
+        /**
+         * @brief Returns the card's rank
+         * @return rank
+         */
+        constexpr PlayingCard::Rank rank() const { return detail::kCompactCardTables.rank[mId]; }
+
+        /**
+         * @brief Returns the card's strength in War, where Ace is high
+         * @return Strength, 2 to 14
+         */
+        constexpr std::uint8_t warStrength() const { return detail::kCompactCardTables.warStrength[mId]; }
+
+        /**
+         * @brief Returns a PlayingCard with the same suite and rank
+         * @return Playing card
+         */
+        constexpr PlayingCard toPlayingCard() const { return PlayingCard(suite(), rank()); }
+
+        constexpr bool operator==(const CompactCard& other) const { return mId == other.mId; }
+        constexpr bool operator!=(const CompactCard& other) const { return mId != other.mId; }
+
+    private:
+        std::uint8_t mId; /**<@brief Card id, 0 to 51 */
+
+};
+
+static_assert(sizeof(CompactCard) == 1, "CompactCard must fit in one byte");
+
+} // namespace doc
+#endif
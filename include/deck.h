@@ -11,9 +11,24 @@
 #ifndef DECK_H
 #define DECK_H
 
+#include "bounded_random.h"
+#include "instrumentation.h"
+#include "seed_stream.h"
 #include <vector>
 #include <algorithm> // for std::swap
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
 
 /**
  * @brief "Deck of Cards" namespace
@@ -26,20 +41,166 @@ namespace doc
  * See https://en.wikipedia.org/wiki/Fisher-Yates_shuffle for background.
  * This algorithnm's time complexity is O(n).
  *
- * @param[in] data Data to shuffle
- * @param[in] randomGenerator 32-bit Mersenne Twister algorithm for generating random numbers.
- *  It is assumed this generator has been seeded appropriately.
+ * Walking from the top of the data down, each element is swapped with an element chosen uniformly from those
+ * not yet visited, including itself, so every permutation is equally likely. Indices are drawn with
+ * BoundedRandom, which avoids divisions and takes two indices from each 64-bit random value.
+ *
+ * @param[in] data Data to shuffle. Any container with size() and operator[], such as std::vector or RingPile.
+ * @param[in] randomGenerator Any UniformRandomBitGenerator, such as std::mt19937 or one of the engines in
+ *  random_engines.h. It is assumed this generator has been seeded appropriately.
  */
-template <class T>
-void knuthShuffle(std::vector<T>& data, std::mt19937& randomGenerator)
+template <class Container, class Rng>
+void knuthShuffle(Container& data, Rng& randomGenerator)
 {
-    std::uniform_int_distribution<unsigned long long> dist(0, data.size() - 1); // dist is range [a, size-1]
-    for (auto& point : data)
+    using std::swap;
+    BoundedRandom<Rng> random(randomGenerator);
+    std::uint64_t remaining = data.size();
+    for (; remaining > std::numeric_limits<std::uint32_t>::max(); remaining--)
+    {
+        swap(data[remaining - 1], data[random.below(remaining)]);
+    }
+    std::uint32_t count = static_cast<std::uint32_t>(remaining);
+    for (; count > 2; count -= 2)
+    {
+        std::uint32_t first;
+        std::uint32_t second;
+        random.below(count, count - 1, first, second);
+        swap(data[count - 1], data[first]);
+        swap(data[count - 2], data[second]);
+    }
+    if (count == 2)
     {
-        std::swap(point, data.at(dist(randomGenerator)));
-    }  
+        swap(data[1], data[random.below(2u)]);
+    }
 }
 
+struct ParallelPolicy; // Defined in parallel_shuffle.h, with Deck::shuffle(const ParallelPolicy&)
+
+namespace detail
+{
+
+/**
+ * @brief True if Storage has emplace_front(), so cards can be added to the bottom of the deck in O(1)
+ */
+template <class Storage, class = void>
+struct HasEmplaceFront : std::false_type {};
+
+template <class Storage>
+struct HasEmplaceFront<Storage, std::void_t<decltype(
+    std::declval<Storage&>().emplace_front(std::declval<typename Storage::value_type>()))>> :
+    std::true_type {};
+
+/**
+ * @brief True if Storage has get_allocator(), so it can be constructed with an allocator
+ */
+template <class Storage, class = void>
+struct HasGetAllocator : std::false_type {};
+
+template <class Storage>
+struct HasGetAllocator<Storage, std::void_t<decltype(std::declval<const Storage&>().get_allocator())>> :
+    std::true_type {};
+
+/**
+ * @brief Returns true if two storages can exchange their contents with swap(), which needs their allocators to
+ * compare equal
+ */
+template <class Storage>
+bool sameAllocator(const Storage& first, const Storage& second)
+{
+    if constexpr (HasGetAllocator<Storage>::value)
+        return first.get_allocator() == second.get_allocator();
+    else
+        return true;
+}
+
+/**
+ * @brief Returns Storage holding data, with the default allocator. Storage is constructed from the vector
+ * directly if it can be, taking over its storage if it is a std::vector<T>.
+ */
+template <class Storage, class Vector>
+Storage makeStorage(Vector&& data)
+{
+    if constexpr (std::is_constructible<Storage, Vector&&>::value)
+        return Storage(std::forward<Vector>(data));
+    else if constexpr (std::is_rvalue_reference<Vector&&>::value)
+        return Storage(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+    else
+        return Storage(data.begin(), data.end());
+}
+
+} // namespace detail
+
+namespace detail
+{
+
+/** @brief Samples of fewer than 1 / kFloydRatio of the cards use Floyd's algorithm */
+constexpr std::size_t kFloydRatio = 16;
+
+/** @brief Floyd's algorithm searches up to this many chosen indices directly, rather than hashing them */
+constexpr std::size_t kFloydSearchLimit = 32;
+
+/**
+ * @brief Returns count distinct indices in [0, size), chosen uniformly at random and in random order, in O(count)
+ * time and memory.
+ *
+ * Small samples use Robert Floyd's algorithm, which draws each index once and keeps the chosen ones in a hash
+ * set. Larger samples take the first count steps of a Fisher-Yates shuffle of the indices, which is faster once
+ * the indices are a sizeable part of the whole.
+ */
+template <class Rng>
+std::vector<std::size_t> sampleIndices(std::size_t size, std::size_t count, Rng& randomGenerator)
+{
+    BoundedRandom<Rng> random(randomGenerator);
+    std::vector<std::size_t> indices;
+    if (count < size / kFloydRatio)
+    {
+        // For each j of the last count indices, choose one of [0, j], taking j itself if that is already chosen.
+        // A few chosen indices are searched directly, rather than kept in a hash set.
+        const bool useSet = count > kFloydSearchLimit;
+        std::unordered_set<std::size_t> chosen(useSet ? 2 * count : 0);
+        indices.reserve(count);
+        for (std::size_t j = size - count; j < size; j++)
+        {
+            std::size_t index = static_cast<std::size_t>(random.below(std::uint64_t(j) + 1));
+            const bool taken = useSet ? !chosen.insert(index).second :
+                std::find(indices.begin(), indices.end(), index) != indices.end();
+            if (taken)
+            {
+                index = j;
+                if (useSet)
+                    chosen.insert(j);
+            }
+            indices.push_back(index);
+        }
+        // Floyd's algorithm chooses a uniformly random set, but not in a random order
+        knuthShuffle(indices, randomGenerator);
+    }
+    else
+    {
+        indices.resize(size);
+        for (std::size_t i = 0; i < size; i++)
+            indices[i] = i;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            using std::swap;
+            swap(indices[i], indices[i + static_cast<std::size_t>(random.below(std::uint64_t(size - i)))]);
+        }
+        indices.resize(count);
+    }
+    return indices;
+}
+
+} // namespace detail
+
+/**
+ * @brief When a Deck does the work of a shuffle
+ */
+enum class ShuffleMode
+{
+    Eager, /**<@brief shuffle() permutes the whole deck, in O(n) */
+    Lazy /**<@brief shuffle() is O(1), and each card dealt is chosen at random from those left, in O(1) */
+};
+
 /**
  * @brief Exception thrown when an attempt to deal a card from an empty Deck occurs.
  */
@@ -54,18 +215,50 @@ class EmptyDeckException : public std::exception
 /**
  * @class Deck "deck.h" "deck.h"
  * 
- * @brief Data is internally stored within an std::vector object. The "back" of the vector represents the top
- * of the deck, the "front" of the vector represents the bottom of the deck. A vector was chosen b/c it is efficient
- * at adding & removing from its end (amortized constant O(1), and drawing from the top of the deck is the
- * most common action done with a deck. It is also efficient for random access which is used by the shuffle method
- * to shuffle the deck.
+ * @brief Data is internally stored within a Storage container, std::vector by default. The "back" of the
+ * Storage represents the top of the deck, the "front" represents the bottom of the deck. A vector is the default
+ * b/c it is efficient at adding & removing from its end (amortized constant O(1), and drawing from the top of the
+ * deck is the most common action done with a deck. It is also efficient for random access which is used by the
+ * shuffle method to shuffle the deck.
  *
  * Other actions such as placing at the bottom of the deck, or placing randomly within the deck, are less common, and
- * I felt did not justify using a different container.
+ * I felt did not justify a different default container. Storage with O(1) emplace_front(), such as RingPile, makes
+ * emplace_bottom() O(1) too.
+ *
+ * The random number generator used to shuffle is the Rng template parameter, and can be any
+ * UniformRandomBitGenerator with a seed(value) method. std::mt19937 is the default, but has about 2.5 KB of
+ * state; the engines in random_engines.h have 8 to 32 bytes. A deck constructed without a seed is seeded from
+ * its thread's SeedStream (see seeding::threadStream()), which reads std::random_device once per process rather
+ * than once per deck. Pass a SeedStream to seed a deck reproducibly.
+ *
+ * The container can be replaced with the Storage template parameter. Storage must provide empty(), size(),
+ * reserve(), back(), pop_back(), push_back(), emplace_back(), clear(), swap(), operator[], begin() and end(),
+ * a constructor from std::vector<T>, and assign(first, last). emplace_bottom() uses emplace_front() if Storage
+ * has it, and emplace(begin(), ...) otherwise. RingPile provides these without allocating after setup, and
+ * StaticPile without allocating at all (see StaticDeck in static_deck.h).
+ *
+ * The allocator is the Storage's: Deck<T, Rng, std::vector<T, Allocator>> allocates with Allocator, and
+ * pmr::Deck allocates from a std::pmr::memory_resource, such as an arena shared by many decks. Pass the
+ * allocator to the constructors taking std::allocator_arg. shuffleIn() and placeUnder() only exchange storage
+ * with a pile whose allocator compares equal to the deck's, and move the cards otherwise.
  *
- * T must meet the requirements of MoveAssignable and MoveConstructible
+ * Cards are moved rather than copied wherever the API allows: data can be moved in with the rvalue
+ * constructor and assign(), moved out with take(), and dealt in bulk with deal_n() and deal_into().
+ *
+ * With ShuffleMode::Lazy, shuffle() only marks the deck as unshuffled. Each card dealt then takes one step of
+ * a Fisher-Yates shuffle, choosing the top card at random from those left, so dealing k cards of an n card
+ * deck costs O(k) rather than O(n). Each step draws its index from a BoundedRandom kept by the deck, so two
+ * cards are dealt per 64-bit random number. Methods that need the whole order, such as contents(), emplace_top()
+ * and take(), finish the pending shuffle first. Either way the deck's contents are a uniformly random
+ * permutation. Finishing a shuffle changes the deck, so only the non-const contents() and cards() do it; their
+ * const overloads throw std::logic_error while a shuffle is pending, and const methods never change the deck.
+ *
+ * sample() and deal_random() draw a few random cards in O(k), without shuffling the whole deck.
+ *
+ * T must meet the requirements of MoveAssignable and MoveConstructible. Only contents(), sample(), and the
+ * constructor and assign() taking a const reference, copy T.
  */
-template <class T>
+template <class T, class Rng = std::mt19937, class Storage = std::vector<T>>
 class Deck
 {
     public:
@@ -84,6 +277,59 @@ class Deck
          */
         Deck(const std::vector<T>& data);
 
+        /**
+         * @brief Construct Deck with data, moving the data in without copying the cards
+         *
+         * Initializes internal random number generator
+         * @param[in] data Data to move into the deck. Left in a valid but unspecified state.
+         */
+        Deck(std::vector<T>&& data);
+
+        /**
+         * @brief Construct Deck with data and a stream to seed its random number generator from
+         * @param[in] data Data to move into the deck
+         * @param[in] stream Stream of seeds (see seed(SeedStream))
+         */
+        Deck(std::vector<T> data, SeedStream stream);
+
+        /**
+         * @brief Construct Deck with the cards of an array, without going through a std::vector
+         *
+         * Initializes internal random number generator
+         * @param[in] data Data to copy into the deck, such as buildStandardDeckArray()
+         */
+        template <std::size_t M>
+        explicit Deck(const std::array<T, M>& data);
+
+        /**
+         * @brief Construct empty deck whose storage allocates with allocator
+         *
+         * Initializes internal random number generator
+         * @param[in] allocator Allocator, or std::pmr::memory_resource* for pmr storage, passed to Storage
+         */
+        template <class Allocator>
+        Deck(std::allocator_arg_t, const Allocator& allocator);
+
+        /**
+         * @brief Construct Deck with data, in storage that allocates with allocator
+         *
+         * Initializes internal random number generator
+         * @param[in] allocator Allocator, or std::pmr::memory_resource* for pmr storage, passed to Storage
+         * @param[in] data Data to copy into the deck
+         */
+        template <class Allocator>
+        Deck(std::allocator_arg_t, const Allocator& allocator, const std::vector<T>& data);
+
+        /**
+         * @brief Move constructor, taking the other deck's cards and random number generator
+         */
+        Deck(Deck&& other);
+
+        /**
+         * @brief Move assignment operator, taking the other deck's cards and random number generator
+         */
+        Deck& operator=(Deck&& other);
+
         /**
          * @brief No copy constructor to prevent multiple decks using the same seeded random number generator
          */
@@ -95,10 +341,56 @@ class Deck
         Deck& operator=(const Deck&) = delete;
 
         /**
-         * @brief Shuffle the deck, randomizing its contents
+         * @brief Re-seed the internal random number generator.
+         *
+         * Decks seeded with the same value shuffle identically, which allows simulations to be reproduced.
+         * @param[in] value Seed for the random number generator
+         */
+        void seed(typename Rng::result_type value);
+
+        /**
+         * @brief Re-seed the internal random number generator from a seed stream, filling its whole state if it
+         * accepts a seed sequence (see SeedStream::seed()).
+         * @param[in] stream Stream of seeds, such as a game's stream split() for each of its decks
+         */
+        void seed(SeedStream stream);
+
+        /**
+         * @brief Returns the internal random number generator, e.g. to save and restore its state. Forgets any
+         * random bits saved from it, as the caller may change its state.
+         */
+        Rng& generator() { mRandom.reset(); return mRandomGen; }
+        const Rng& generator() const { return mRandomGen; }
+
+        /**
+         * @brief Shuffle the deck, randomizing its contents.
+         *
+         * With ShuffleMode::Lazy this is O(1), and the cards are shuffled as they are dealt.
          */
         void shuffle();
 
+        /**
+         * @brief Shuffle the deck across many threads, for very large decks (see parallelShuffle()). Defined in
+         * parallel_shuffle.h, which must be included to use it.
+         *
+         * Always shuffles the whole deck, whatever the shuffle mode. Decks seeded alike shuffle identically
+         * for the same policy.threads, on any pool.
+         * @param[in] policy Number of blocks and threads, and the pool to run on
+         */
+        void shuffle(const ParallelPolicy& policy);
+
+        /**
+         * @brief Set when the deck does the work of a shuffle. Finishes any pending lazy shuffle when set to
+         * ShuffleMode::Eager.
+         * @param[in] mode Shuffle mode. Decks start with ShuffleMode::Eager.
+         */
+        void setShuffleMode(ShuffleMode mode);
+
+        /**
+         * @brief Returns when the deck does the work of a shuffle
+         */
+        ShuffleMode shuffleMode() const { return mShuffleMode; }
+
         /**
          * @brief Returns if the deck is empty
          * @return True if the deck is empty, false otherwise */
@@ -119,86 +411,572 @@ class Deck
         T deal_card();
 
         /**
-         * @brief Returns the contents of this deck, without clearing the deck.
+         * @brief Removes and returns the card at the top of the deck, or returns no card if the deck is empty.
+         *
+         * Does not throw, unless moving T throws, for loops that deal until the deck runs out.
+         * @return Card at top of deck, or std::nullopt if the deck is empty
+         */
+        std::optional<T> try_deal() noexcept(std::is_nothrow_move_constructible<T>::value);
+
+        /**
+         * @brief Deals a number of cards from the top of the deck, moving them to an output iterator in the order
+         * they are dealt.
+         *
+         * Throws an EmptyDeckException, without dealing any cards, if the deck has fewer than count cards
+         * @param[in] count Number of cards to deal
+         * @param[in] out Output iterator to move the cards to
+         * @return Output iterator past the last card dealt
+         */
+        template <class OutputIt>
+        OutputIt deal_n(size_t count, OutputIt out);
+
+        /**
+         * @brief Deals up to count cards from the top of the deck into an array, in the order they are dealt.
+         *
+         * Deals fewer cards if the deck runs out, and never throws unless moving T throws.
+         * @param[in] destination Array with room for at least count cards
+         * @param[in] count Maximum number of cards to deal
+         * @return Number of cards dealt
+         */
+        size_t deal_into(T* destination, size_t count);
+
+        /**
+         * @brief Copies a random sample of the deck's cards to an output iterator, leaving the deck as it is.
+         *
+         * Every set of count cards is equally likely, and the sample is in a random order. Takes O(count) time
+         * and memory, however large the deck, rather than the O(n) of shuffling the deck to deal from it. If
+         * the deck has fewer than count cards, all of them are copied, as with std::sample().
+         * @param[in] count Number of cards to sample
+         * @param[in] out Output iterator to copy the cards to
+         * @return Output iterator past the last card copied
+         */
+        template <class OutputIt>
+        OutputIt sample(size_t count, OutputIt out);
+
+        /**
+         * @brief Removes count cards chosen at random from the deck and returns them, in a random order.
+         *
+         * Takes the first count steps of a Fisher-Yates shuffle, so the cost is O(count) rather than the O(n) of
+         * shuffling the whole deck. The cards left may be reordered: each card dealt is replaced by the top card.
+         * Throws an EmptyDeckException, without dealing any cards, if the deck has fewer than count cards
+         * @param[in] count Number of cards to deal
+         * @return Cards dealt
+         */
+        std::vector<T> deal_random(size_t count);
+
+        /**
+         * @brief Constructs a card in place on top of the deck
+         * @param[in] args Arguments to construct the card with
+         * @return The new card
+         */
+        template <class... Args>
+        T& emplace_top(Args&&... args);
+
+        /**
+         * @brief Constructs a card in place at the bottom of the deck.
+         *
+         * O(1) if Storage has emplace_front(), such as RingPile, and O(n) for std::vector.
+         * @param[in] args Arguments to construct the card with
+         * @return The new card
+         */
+        template <class... Args>
+        T& emplace_bottom(Args&&... args);
+
+        /**
+         * @brief Returns the contents of this deck, without clearing the deck. Finishes a pending lazy shuffle.
          *
          * This method can be used to create a second Deck with the same contents of this Deck, but without
          * the same random number generator used to shuffle the deck.
          * @return Deck contents
          */
+        std::vector<T> contents();
+
+        /**
+         * @brief Returns the contents of a deck that has no lazy shuffle pending, without changing the deck.
+         *
+         * Throws std::logic_error if a lazy shuffle is pending, as the order of the cards is not decided until
+         * it is finished, which a const deck cannot do.
+         * @return Deck contents
+         */
         std::vector<T> contents() const;
 
+        /**
+         * @brief Returns the deck's cards in place, bottom of the deck first, to walk without copying them.
+         * Finishes a pending lazy shuffle.
+         */
+        const Storage& cards();
+
+        /**
+         * @brief Returns the cards in place of a deck that has no lazy shuffle pending, without changing the deck.
+         * Throws std::logic_error if a lazy shuffle is pending, as contents() const does.
+         */
+        const Storage& cards() const;
+
+        /**
+         * @brief Returns if a lazy shuffle has not been finished, so the order of the cards is not yet decided
+         */
+        bool shufflePending() const { return mShufflePending; }
+
         /**
          * @brief Replaces the contents of the Deck
          * @param[in] data Data to replace contents.
          */
         void assign(const std::vector<T>& data);
 
+        /**
+         * @brief Replaces the contents of the Deck, moving the data in without copying the cards
+         * @param[in] data Data to replace contents. Left in a valid but unspecified state.
+         */
+        void assign(std::vector<T>&& data);
+
+        /**
+         * @brief Returns the contents of this deck, moving them out and leaving the deck empty.
+         *
+         * Unlike contents(), no cards are copied. With the default std::vector storage the deck's storage itself
+         * is returned, so nothing is allocated.
+         * @return Deck contents, bottom of the deck first
+         */
+        std::vector<T> take();
+
+        /**
+         * @brief Moves every card of a pile into the deck, leaving the pile empty, and shuffles the deck.
+         *
+         * If the deck is empty the deck and pile exchange storage, so no cards are copied and nothing is
+         * allocated. Otherwise the pile's cards are added to the deck, which must have the capacity for them if
+         * Storage has a fixed capacity, unless the pile's allocator differs and the deck reserves it.
+         * @param[in] pile Pile to move into the deck. Left empty, with the deck's previous storage.
+         */
+        void shuffleIn(Storage& pile);
+
+        /**
+         * @brief Moves every card of a pile under the deck, in order, leaving the pile empty. Does not shuffle.
+         *
+         * The top of the pile ends up just below the bottom of the deck. If the deck is empty the deck and pile
+         * exchange storage, as with shuffleIn(). Otherwise the pile must have the capacity for the deck's
+         * cards if Storage has a fixed capacity.
+         * @param[in] pile Pile to move under the deck. Left empty.
+         */
+        void placeUnder(Storage& pile);
+
+        /**
+         * @brief Reserve storage for a number of cards, so adding up to that many cards does not allocate.
+         * @param[in] capacity Number of cards to reserve storage for
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Returns the allocator of the deck's storage. Only available if Storage has get_allocator().
+         */
+        auto get_allocator() const { return mData.get_allocator(); }
+
 
     private:
 
-        std::vector<T> mData; /**<@brief Deck's data */
-        std::mt19937 mRandomGen; /**<@brief Use for shuffling */
+        /**
+         * @brief With a lazy shuffle pending, moves a random card left to the top of the deck
+         */
+        void prepareTop();
+
+        /**
+         * @brief Finishes a pending lazy shuffle
+         */
+        void settle();
+
+        /**
+         * @brief Throws std::logic_error if a lazy shuffle is pending, for the const views of the cards
+         */
+        void checkSettled() const;
+
+        Storage mData; /**<@brief Deck's data */
+        Rng mRandomGen; /**<@brief Use for shuffling */
+        BoundedRandom<Rng> mRandom{mRandomGen}; /**<@brief Draws from mRandomGen for each lazy or random deal */
+        bool mShufflePending = false; /**<@brief If a lazy shuffle has not been finished */
+        ShuffleMode mShuffleMode = ShuffleMode::Eager; /**<@brief When the deck does the work of a shuffle */
 
 };
 
 // Definition below
-template<class T>
-Deck<T>::Deck()
+template<class T, class Rng, class Storage>
+Deck<T, Rng, Storage>::Deck()
+{
+    seeding::threadStream().seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+Deck<T, Rng, Storage>::Deck(const std::vector<T>& data) :
+    mData(detail::makeStorage<Storage>(data))
+{
+    seeding::threadStream().seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+Deck<T, Rng, Storage>::Deck(std::vector<T>&& data) :
+    mData(detail::makeStorage<Storage>(std::move(data)))
+{
+    seeding::threadStream().seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+Deck<T, Rng, Storage>::Deck(std::vector<T> data, SeedStream stream) :
+    mData(detail::makeStorage<Storage>(std::move(data)))
+{
+    stream.seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+template <std::size_t M>
+Deck<T, Rng, Storage>::Deck(const std::array<T, M>& data)
+{
+    mData.assign(data.begin(), data.end());
+    seeding::threadStream().seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+template <class Allocator>
+Deck<T, Rng, Storage>::Deck(std::allocator_arg_t, const Allocator& allocator) :
+    mData(allocator)
+{
+    seeding::threadStream().seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+template <class Allocator>
+Deck<T, Rng, Storage>::Deck(std::allocator_arg_t, const Allocator& allocator, const std::vector<T>& data) :
+    mData(allocator)
+{
+    mData.assign(data.begin(), data.end());
+    seeding::threadStream().seed(mRandomGen);
+}
+
+template<class T, class Rng, class Storage>
+Deck<T, Rng, Storage>::Deck(Deck&& other) :
+    mData(std::move(other.mData)),
+    mRandomGen(std::move(other.mRandomGen)),
+    mShufflePending(other.mShufflePending),
+    mShuffleMode(other.mShuffleMode)
+{
+    // mRandom draws from this deck's generator, keeping the bits other's saved from the same sequence
+    mRandom.takeSaved(other.mRandom);
+}
+
+template<class T, class Rng, class Storage>
+Deck<T, Rng, Storage>& Deck<T, Rng, Storage>::operator=(Deck&& other)
+{
+    mData = std::move(other.mData);
+    mRandomGen = std::move(other.mRandomGen);
+    mRandom.takeSaved(other.mRandom);
+    mShufflePending = other.mShufflePending;
+    mShuffleMode = other.mShuffleMode;
+    return *this;
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::seed(typename Rng::result_type value)
+{
+    mRandomGen.seed(value);
+    mRandom.reset();
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::seed(SeedStream stream)
+{
+    stream.seed(mRandomGen);
+    mRandom.reset();
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::shuffle()
 {
-    std::random_device randomSeeder;
-    mRandomGen.seed(randomSeeder());
+    DOC_COUNT(shuffles, 1);
+    if (mShuffleMode == ShuffleMode::Lazy)
+        mShufflePending = true;
+    else
+    {
+        DOC_COUNT(shuffledElements, mData.size());
+        knuthShuffle(mData, mRandomGen);
+    }
 }
 
-template<class T>
-Deck<T>::Deck(const std::vector<T>& data) :
-    mData(data)
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::setShuffleMode(ShuffleMode mode)
 {
-    std::random_device randomSeeder;
-    mRandomGen.seed(randomSeeder());
+    if (mode == ShuffleMode::Eager)
+        settle();
+    mShuffleMode = mode;
 }
 
-template<class T>
-void Deck<T>::shuffle()
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::prepareTop()
 {
-    knuthShuffle<T>(mData, mRandomGen);
+    // One step of a Fisher-Yates shuffle. The cards below stay unshuffled until they are dealt.
+    if (mShufflePending && mData.size() > 1)
+    {
+        using std::swap;
+        DOC_COUNT(shuffledElements, 1);
+        const std::uint64_t chosen = mRandom.below(std::uint64_t(mData.size()));
+        swap(mData[chosen], mData.back());
+    }
 }
 
-template<class T>
-bool Deck<T>::empty() const
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::settle()
+{
+    if (mShufflePending)
+    {
+        DOC_COUNT(shuffledElements, mData.size());
+        knuthShuffle(mData, mRandomGen);
+        mShufflePending = false;
+    }
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::checkSettled() const
+{
+    if (mShufflePending)
+        throw std::logic_error("Deck has a lazy shuffle pending, so its cards have no order yet");
+}
+
+template<class T, class Rng, class Storage>
+bool Deck<T, Rng, Storage>::empty() const
 {
     return mData.empty();
 }
 
-template<class T>
-size_t Deck<T>::size() const
+template<class T, class Rng, class Storage>
+size_t Deck<T, Rng, Storage>::size() const
 {
     return mData.size();
 }
 
-template<class T>
-T Deck<T>::deal_card()
+template<class T, class Rng, class Storage>
+T Deck<T, Rng, Storage>::deal_card()
 {
     if (mData.empty())
         throw EmptyDeckException();
     else
     {
-        const T card = mData.back();
+        DOC_COUNT(deals, 1);
+        prepareTop();
+        T card = std::move(mData.back());
         mData.pop_back();
         return card;
     }
 }
 
-template<class T>
-std::vector<T> Deck<T>::contents() const
+template<class T, class Rng, class Storage>
+std::optional<T> Deck<T, Rng, Storage>::try_deal() noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (mData.empty())
+        return std::nullopt;
+    DOC_COUNT(deals, 1);
+    prepareTop();
+    std::optional<T> card(std::move(mData.back()));
+    mData.pop_back();
+    return card;
+}
+
+template<class T, class Rng, class Storage>
+template <class OutputIt>
+OutputIt Deck<T, Rng, Storage>::deal_n(size_t count, OutputIt out)
+{
+    if (count > mData.size())
+        throw EmptyDeckException();
+    DOC_COUNT(deals, count);
+    for (; count > 0; count--)
+    {
+        prepareTop();
+        *out = std::move(mData.back());
+        ++out;
+        mData.pop_back();
+    }
+    return out;
+}
+
+template<class T, class Rng, class Storage>
+template <class OutputIt>
+OutputIt Deck<T, Rng, Storage>::sample(size_t count, OutputIt out)
+{
+    count = std::min(count, size_t(mData.size()));
+    for (const std::size_t index : detail::sampleIndices(mData.size(), count, mRandomGen))
+    {
+        *out = mData[index];
+        ++out;
+    }
+    return out;
+}
+
+template<class T, class Rng, class Storage>
+std::vector<T> Deck<T, Rng, Storage>::deal_random(size_t count)
+{
+    if (count > mData.size())
+        throw EmptyDeckException();
+    DOC_COUNT(deals, count);
+    DOC_COUNT(shuffledElements, count);
+    std::vector<T> cards;
+    cards.reserve(count);
+    for (; count > 0; count--)
+    {
+        using std::swap;
+        const std::uint64_t chosen = mRandom.below(std::uint64_t(mData.size()));
+        swap(mData[chosen], mData.back());
+        cards.push_back(std::move(mData.back()));
+        mData.pop_back();
+    }
+    return cards;
+}
+
+template<class T, class Rng, class Storage>
+size_t Deck<T, Rng, Storage>::deal_into(T* destination, size_t count)
+{
+    const size_t dealt = std::min(count, mData.size());
+    deal_n(dealt, destination);
+    return dealt;
+}
+
+template<class T, class Rng, class Storage>
+template <class... Args>
+T& Deck<T, Rng, Storage>::emplace_top(Args&&... args)
+{
+    settle();
+    mData.emplace_back(std::forward<Args>(args)...);
+    return mData.back();
+}
+
+template<class T, class Rng, class Storage>
+template <class... Args>
+T& Deck<T, Rng, Storage>::emplace_bottom(Args&&... args)
+{
+    settle();
+    if constexpr (detail::HasEmplaceFront<Storage>::value)
+    {
+        mData.emplace_front(std::forward<Args>(args)...);
+        return mData.front();
+    }
+    else
+        return *mData.emplace(mData.begin(), std::forward<Args>(args)...);
+}
+
+template<class T, class Rng, class Storage>
+std::vector<T> Deck<T, Rng, Storage>::contents()
+{
+    settle();
+    return std::vector<T>(mData.begin(), mData.end());
+}
+
+template<class T, class Rng, class Storage>
+std::vector<T> Deck<T, Rng, Storage>::contents() const
+{
+    checkSettled();
+    return std::vector<T>(mData.begin(), mData.end());
+}
+
+template<class T, class Rng, class Storage>
+const Storage& Deck<T, Rng, Storage>::cards()
+{
+    settle();
+    return mData;
+}
+
+template<class T, class Rng, class Storage>
+const Storage& Deck<T, Rng, Storage>::cards() const
 {
+    checkSettled();
     return mData;
 }
 
-template<class T>
-void Deck<T>::assign(const std::vector<T>& data)
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::assign(const std::vector<T>& data)
+{
+    mData.assign(data.begin(), data.end());
+    mShufflePending = false;
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::assign(std::vector<T>&& data)
+{
+    if constexpr (std::is_same<Storage, std::vector<T>>::value)
+        mData = std::move(data);
+    else
+        mData.assign(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+    mShufflePending = false;
+}
+
+template<class T, class Rng, class Storage>
+std::vector<T> Deck<T, Rng, Storage>::take()
+{
+    settle();
+    if constexpr (std::is_same<Storage, std::vector<T>>::value)
+    {
+        std::vector<T> data;
+        data.swap(mData);
+        return data;
+    }
+    else
+    {
+        std::vector<T> data(std::make_move_iterator(mData.begin()), std::make_move_iterator(mData.end()));
+        mData.clear();
+        return data;
+    }
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::shuffleIn(Storage& pile)
+{
+    if (mData.empty() && detail::sameAllocator(mData, pile))
+    {
+        mData.swap(pile);
+    }
+    else
+    {
+        if (!detail::sameAllocator(mData, pile))
+            mData.reserve(mData.size() + pile.size());
+        for (auto& card : pile)
+            mData.push_back(std::move(card));
+        pile.clear();
+    }
+    shuffle();
+}
+
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::placeUnder(Storage& pile)
 {
-    mData = data;
+    settle();
+    if (!detail::sameAllocator(mData, pile))
+    {
+        // The storages cannot be exchanged, so the cards are moved into the deck's storage instead
+        std::vector<T> deck(std::make_move_iterator(mData.begin()), std::make_move_iterator(mData.end()));
+        mData.reserve(deck.size() + pile.size());
+        mData.assign(std::make_move_iterator(pile.begin()), std::make_move_iterator(pile.end()));
+        for (auto& card : deck)
+            mData.push_back(std::move(card));
+        pile.clear();
+        return;
+    }
+    if (!mData.empty())
+    {
+        for (auto& card : mData)
+            pile.push_back(std::move(card));
+        mData.clear();
+    }
+    mData.swap(pile);
 }
 
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::reserve(size_t capacity)
+{
+    mData.reserve(capacity);
+}
+
+/**
+ * @brief Aliases of the library's containers that allocate from a std::pmr::memory_resource
+ */
+namespace pmr
+{
+
+template <class T, class Rng = std::mt19937>
+using Deck = doc::Deck<T, Rng, std::pmr::vector<T>>;
+
+} // namespace pmr
+
 } // namespace doc
 #endif
@@ -0,0 +1,335 @@
+/**
+ * @file deck_batch.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare DeckBatch class, that stores many small decks side by side so they can be shuffled together,
+ * and the shuffleBatch function that shuffles them.
+ */
+
+#ifndef DECK_BATCH_H
+#define DECK_BATCH_H
+
+#include "random_engines.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class BatchRng "deck_batch.h" "deck_batch.h"
+ *
+ * @brief Eight xoshiro128++ generators run in lockstep, producing eight 32-bit random values per call.
+ * See https://prng.di.unimi.it/xoshiro128plusplus.c
+ *
+ * The state is stored lane by lane, so when compiled with AVX2 all eight generators advance with a handful of
+ * vector instructions. Without AVX2 the same values are produced one lane at a time.
+ */
+class BatchRng
+{
+    public:
+
+        static constexpr std::size_t kLanes = 8; /**<@brief Number of generators */
+
+        /**
+         * @brief Construct generators with a seed
+         * @param[in] value Seed, any value is valid. It is expanded into every lane's state with SplitMix64.
+         */
+        explicit BatchRng(std::uint64_t value = 0) { seed(value); }
+
+        /**
+         * @brief Re-seed the generators
+         * @param[in] value Seed, any value is valid. It is expanded into every lane's state with SplitMix64.
+         */
+        void seed(std::uint64_t value)
+        {
+            SplitMix64 expander(value);
+            for (std::size_t lane = 0; lane < kLanes; lane++)
+            {
+                const std::uint64_t low = expander();
+                const std::uint64_t high = expander();
+                mState[0][lane] = static_cast<std::uint32_t>(low);
+                mState[1][lane] = static_cast<std::uint32_t>(low >> 32);
+                mState[2][lane] = static_cast<std::uint32_t>(high);
+                mState[3][lane] = static_cast<std::uint32_t>(high >> 32) | 1; // never all zero
+            }
+        }
+
+        /**
+         * @brief Produce the next random value of every lane
+         * @param[out] values One random value per lane
+         */
+        void next(std::uint32_t (&values)[kLanes])
+        {
+#if defined(__AVX2__)
+            __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[0]));
+            __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[1]));
+            __m256i s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[2]));
+            __m256i s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[3]));
+
+            const __m256i sum = _mm256_add_epi32(s0, s3);
+            const __m256i result = _mm256_add_epi32(
+                _mm256_or_si256(_mm256_slli_epi32(sum, 7), _mm256_srli_epi32(sum, 25)), s0);
+            const __m256i t = _mm256_slli_epi32(s1, 9);
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[0]), s0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[1]), s1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[2]), s2);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[3]), s3);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), result);
+#else
+            for (std::size_t lane = 0; lane < kLanes; lane++)
+            {
+                const std::uint32_t sum = mState[0][lane] + mState[3][lane];
+                values[lane] = ((sum << 7) | (sum >> 25)) + mState[0][lane];
+                const std::uint32_t t = mState[1][lane] << 9;
+                mState[2][lane] ^= mState[0][lane];
+                mState[3][lane] ^= mState[1][lane];
+                mState[1][lane] ^= mState[2][lane];
+                mState[0][lane] ^= mState[3][lane];
+                mState[2][lane] ^= t;
+                mState[3][lane] = (mState[3][lane] << 11) | (mState[3][lane] >> 21);
+            }
+#endif
+        }
+
+        /**
+         * @brief Produce the next several random values of every lane, keeping the state in registers
+         * @param[out] values One row of random values per call to next()
+         * @param[in] rows Number of rows to produce
+         */
+        void fill(std::uint32_t (*values)[kLanes], std::size_t rows)
+        {
+#if defined(__AVX2__)
+            __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[0]));
+            __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[1]));
+            __m256i s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[2]));
+            __m256i s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mState[3]));
+            for (std::size_t row = 0; row < rows; row++)
+            {
+                const __m256i sum = _mm256_add_epi32(s0, s3);
+                const __m256i result = _mm256_add_epi32(
+                    _mm256_or_si256(_mm256_slli_epi32(sum, 7), _mm256_srli_epi32(sum, 25)), s0);
+                const __m256i t = _mm256_slli_epi32(s1, 9);
+                s2 = _mm256_xor_si256(s2, s0);
+                s3 = _mm256_xor_si256(s3, s1);
+                s1 = _mm256_xor_si256(s1, s2);
+                s0 = _mm256_xor_si256(s0, s3);
+                s2 = _mm256_xor_si256(s2, t);
+                s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(values[row]), result);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[0]), s0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[1]), s1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[2]), s2);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mState[3]), s3);
+#else
+            for (std::size_t row = 0; row < rows; row++)
+                next(values[row]);
+#endif
+        }
+
+    private:
+        alignas(32) std::uint32_t mState[4][kLanes]; /**<@brief Each state word, for every lane */
+};
+
+class DeckBatch;
+inline void shuffleBatch(DeckBatch& batch, BatchRng& randomGenerator);
+
+/**
+ * @class DeckBatch "deck_batch.h" "deck_batch.h"
+ *
+ * @brief Many decks of the same size, stored structure-of-arrays: every deck's card at a position is stored
+ * next to each other. This lets shuffleBatch() shuffle a group of decks in lockstep, drawing the random
+ * indices for a whole group at once.
+ *
+ * Cards are one byte ids, such as CompactCard::id(), so a deck holds at most 256 cards. A new batch holds
+ * every deck in order, with card id p at position p. Position 0 is the bottom of the deck, the same as Deck.
+ */
+class DeckBatch
+{
+    public:
+
+        /**
+         * @brief Construct batch of decks, each in order
+         * @param[in] numDecks Number of decks
+         * @param[in] deckSize Number of cards in each deck, at most 256
+         */
+        DeckBatch(std::size_t numDecks, std::size_t deckSize) :
+            mDecks(numDecks),
+            mDeckSize(deckSize),
+            mStride((numDecks + BatchRng::kLanes - 1) / BatchRng::kLanes * BatchRng::kLanes),
+            mCards(mStride * deckSize)
+        {
+            if (deckSize > 256)
+                throw std::invalid_argument("DeckBatch decks hold at most 256 cards");
+            reset();
+        }
+
+        /**
+         * @brief Returns the number of decks in the batch
+         */
+        std::size_t decks() const { return mDecks; }
+
+        /**
+         * @brief Returns the number of cards in each deck
+         */
+        std::size_t deckSize() const { return mDeckSize; }
+
+        /**
+         * @brief Put every deck back in order
+         */
+        void reset()
+        {
+            for (std::size_t position = 0; position < mDeckSize; position++)
+            {
+                for (std::size_t deck = 0; deck < mStride; deck++)
+                    mCards[position * mStride + deck] = static_cast<std::uint8_t>(position);
+            }
+        }
+
+        /**
+         * @brief Returns the card at a position of a deck
+         * @param[in] deck Deck number, less than decks()
+         * @param[in] position Position in the deck, less than deckSize()
+         * @return Card id
+         */
+        std::uint8_t& card(std::size_t deck, std::size_t position) { return mCards[position * mStride + deck]; }
+        std::uint8_t card(std::size_t deck, std::size_t position) const { return mCards[position * mStride + deck]; }
+
+        /**
+         * @brief Returns the cards of one deck, from bottom to top, in the same layout as Deck::contents()
+         * @param[in] deck Deck number, less than decks()
+         * @return Card ids
+         */
+        std::vector<std::uint8_t> contents(std::size_t deck) const
+        {
+            std::vector<std::uint8_t> cards(mDeckSize);
+            for (std::size_t position = 0; position < mDeckSize; position++)
+                cards[position] = card(deck, position);
+            return cards;
+        }
+
+    private:
+
+        friend void shuffleBatch(DeckBatch& batch, BatchRng& randomGenerator);
+
+        std::size_t mDecks; /**<@brief Number of decks */
+        std::size_t mDeckSize; /**<@brief Number of cards in each deck */
+        std::size_t mStride; /**<@brief Distance between positions, decks rounded up to a whole group */
+        std::vector<std::uint8_t> mCards; /**<@brief Cards, position by position */
+};
+
+/**
+ * @brief Shuffle every deck of a batch with the Fisher-Yates shuffle, eight decks at a time.
+ *
+ * Each group of eight decks takes one lane of the generator each. At every step the eight decks draw their
+ * index in the same range, so one vector of random values and one rejection threshold serve the whole group
+ * (Lemire's nearly divisionless method, as in BoundedRandom). The swaps themselves are done deck by deck.
+ *
+ * The result depends only on the generator's state, not on whether AVX2 is used.
+ * @param[in] batch Decks to shuffle
+ * @param[in] randomGenerator Generator, which is assumed to be seeded appropriately
+ */
+inline void shuffleBatch(DeckBatch& batch, BatchRng& randomGenerator)
+{
+    const std::size_t lanes = BatchRng::kLanes;
+    const std::size_t steps = batch.mDeckSize > 1 ? batch.mDeckSize - 1 : 0;
+
+    // Rejection threshold of each range, shared by every group
+    std::uint32_t thresholds[257];
+    for (std::uint32_t count = 2; count <= batch.mDeckSize; count++)
+        thresholds[count] = (0u - count) % count;
+
+    // Step s of a group draws an index in [0, deckSize - s) for each lane
+    alignas(32) std::uint32_t words[256][BatchRng::kLanes];
+    alignas(32) std::uint32_t indices[256][BatchRng::kLanes];
+
+    for (std::size_t group = 0; group < batch.mStride; group += lanes)
+    {
+        // Draw every random value the group needs at once, then map them to indices
+        randomGenerator.fill(words, steps);
+        bool rejected = false;
+        for (std::size_t step = 0; step < steps; step++)
+        {
+            const std::uint32_t count = static_cast<std::uint32_t>(batch.mDeckSize - step);
+#if defined(__AVX2__)
+            const __m256i range = _mm256_set1_epi32(static_cast<int>(count));
+            const __m256i values = _mm256_load_si256(reinterpret_cast<const __m256i*>(words[step]));
+            // 32x32->64 bit products of the even lanes, then of the odd lanes
+            const __m256i evenProducts = _mm256_mul_epu32(values, range);
+            const __m256i oddProducts = _mm256_mul_epu32(_mm256_srli_epi64(values, 32), range);
+            // high halves are the indices, low halves are checked against the threshold
+            const __m256i high = _mm256_blend_epi32(_mm256_srli_epi64(evenProducts, 32), oddProducts, 0xAA);
+            const __m256i low = _mm256_blend_epi32(evenProducts, _mm256_slli_epi64(oddProducts, 32), 0xAA);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(indices[step]), high);
+            // unsigned low < threshold, as a signed compare after flipping the sign bits
+            const __m256i flip = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+            const __m256i threshold = _mm256_set1_epi32(static_cast<int>(thresholds[count] ^ 0x80000000u));
+            const __m256i below = _mm256_cmpgt_epi32(threshold, _mm256_xor_si256(low, flip));
+            rejected |= !_mm256_testz_si256(below, below);
+#else
+            for (std::size_t lane = 0; lane < lanes; lane++)
+            {
+                const std::uint64_t product = static_cast<std::uint64_t>(words[step][lane]) * count;
+                indices[step][lane] = static_cast<std::uint32_t>(product >> 32);
+                rejected |= static_cast<std::uint32_t>(product) < thresholds[count];
+            }
+#endif
+        }
+
+        if (rejected) // rare, at most deckSize^2 / 2^32 per group: redraw the biased values one at a time
+        {
+            for (std::size_t step = 0; step < steps; step++)
+            {
+                const std::uint32_t count = static_cast<std::uint32_t>(batch.mDeckSize - step);
+                for (std::size_t lane = 0; lane < lanes; lane++)
+                {
+                    std::uint64_t product = static_cast<std::uint64_t>(words[step][lane]) * count;
+                    while (static_cast<std::uint32_t>(product) < thresholds[count])
+                    {
+                        std::uint32_t redraw[BatchRng::kLanes];
+                        randomGenerator.next(redraw);
+                        product = static_cast<std::uint64_t>(redraw[lane]) * count;
+                    }
+                    indices[step][lane] = static_cast<std::uint32_t>(product >> 32);
+                }
+            }
+        }
+
+        // Fisher-Yates swaps, from the top of each deck down
+        std::uint8_t* const cards = batch.mCards.data() + group;
+        for (std::size_t step = 0; step < steps; step++)
+        {
+            std::uint8_t* const top = cards + (batch.mDeckSize - 1 - step) * batch.mStride;
+            for (std::size_t lane = 0; lane < lanes; lane++)
+            {
+                std::uint8_t& other = cards[indices[step][lane] * batch.mStride + lane];
+                const std::uint8_t card = top[lane];
+                top[lane] = other;
+                other = card;
+            }
+        }
+    }
+}
+
+} // namespace doc
+#endif
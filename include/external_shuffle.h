@@ -0,0 +1,424 @@
+/**
+ * @file external_shuffle.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare externalShuffle, that shuffles files of records larger than memory with large sequential
+ * reads and writes, and FileDeck class, that deals the records of a file like a Deck.
+ */
+
+#ifndef EXTERNAL_SHUFFLE_H
+#define EXTERNAL_SHUFFLE_H
+
+#include "bounded_random.h"
+#include "deck.h"
+#include "random_engines.h"
+#include "seed_stream.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+namespace detail
+{
+
+/**
+ * @class BinaryFile "external_shuffle.h" "external_shuffle.h"
+ * @brief An open file, read and written in large blocks, and closed by the destructor.
+ *
+ * Throws std::system_error if a file cannot be opened, read or written.
+ */
+class BinaryFile
+{
+    public:
+
+        BinaryFile() = default;
+        ~BinaryFile();
+        BinaryFile(BinaryFile&& other) noexcept;
+        BinaryFile& operator=(BinaryFile&& other) noexcept;
+        BinaryFile(const BinaryFile&) = delete;
+        BinaryFile& operator=(const BinaryFile&) = delete;
+
+        /**
+         * @brief Opens a file to read from start to end
+         */
+        static BinaryFile openRead(const std::string& path);
+
+        /**
+         * @brief Creates or truncates a file to write
+         */
+        static BinaryFile create(const std::string& path);
+
+        /**
+         * @brief Creates a file to write and read back, which is removed from the directory at once, so its
+         * space is freed when it is closed, even if the process ends first
+         * @param[in] directory Directory to create the file in
+         */
+        static BinaryFile temporary(const std::string& directory);
+
+        /**
+         * @brief Returns the size of the file in bytes
+         */
+        std::uint64_t size() const;
+
+        /**
+         * @brief Reads up to bytes bytes from the current position
+         * @return Bytes read, fewer than asked for only at the end of the file
+         */
+        std::size_t read(void* data, std::size_t bytes);
+
+        /**
+         * @brief Writes bytes bytes at the current position
+         */
+        void write(const void* data, std::size_t bytes);
+
+        /**
+         * @brief Moves back to the start of the file
+         */
+        void rewind();
+
+        /**
+         * @brief Closes the file
+         */
+        void close();
+
+    private:
+
+        BinaryFile(int fd, std::string name) : mFd(fd), mName(std::move(name)) {}
+
+        int mFd = -1; /**<@brief File descriptor, or -1 if no file is open */
+        std::string mName; /**<@brief Path of the file, for error messages */
+
+};
+
+/**
+ * @brief Returns the directory part of a path, or "." if it has none
+ */
+std::string directoryOf(const std::string& path);
+
+} // namespace detail
+
+/**
+ * @brief Limits of an external shuffle
+ */
+struct ExternalShuffleOptions
+{
+    /** @brief Memory to use, approximately. Buckets are aimed at half of it, so they fit with room to spare.
+     * Each bucket's write buffer takes at least 64 KiB, whatever this is set to. */
+    std::size_t memoryBytes = std::size_t(256) << 20;
+
+    /** @brief Directory of the temporary bucket files. Empty uses the output file's directory. */
+    std::string tempDirectory;
+};
+
+/**
+ * @brief Shuffles a file of records into another file, or into itself, using memory of about
+ * options.memoryBytes whatever the size of the file. The output is a uniformly random permutation of the
+ * input's records.
+ *
+ * Two passes: the input is read in order, and each record is appended to one of up to 256 temporary bucket
+ * files, chosen uniformly at random. Then each bucket is read into memory, shuffled with knuthShuffle() and
+ * appended to the output. A bucket too large for memory is split again in the same way. Every read and write is
+ * a large sequential block, rather than the random page faults of shuffling a memory-mapped file in place. The
+ * bucket files take as much disk space as the input, and are removed as they are used.
+ *
+ * The shuffle depends only on the stream and the size of the input and options.memoryBytes.
+ *
+ * Throws std::system_error if a file cannot be opened, read or written, and std::invalid_argument if the
+ * input's size is not a whole number of records.
+ *
+ * @param[in] inputPath File of records of type T, as written from memory
+ * @param[in] outputPath File to write the shuffled records to. May be inputPath, to shuffle it in place.
+ * @param[in] stream Stream of seeds for the shuffle
+ * @param[in] options Memory to use and where to keep the bucket files
+ * @tparam T Record type. Must be trivially copyable, and default constructible.
+ * @tparam Rng Random number generator of each bucket
+ */
+template <class T, class Rng = Xoshiro256StarStar>
+void externalShuffle(const std::string& inputPath, const std::string& outputPath, SeedStream stream,
+        const ExternalShuffleOptions& options = ExternalShuffleOptions());
+
+/**
+ * @class FileDeck "external_shuffle.h" "external_shuffle.h"
+ * @brief Deals the records of a file one at a time, like a Deck, reading them in large blocks.
+ *
+ * Records are dealt in the order they are stored, from the start of the file, so the deck of a file shuffled
+ * with externalShuffle() deals a random order. Only one block of records is in memory at a time.
+ *
+ * T must be trivially copyable, and default constructible.
+ */
+template <class T>
+class FileDeck
+{
+    public:
+
+        /** @brief Default size of the block read at a time */
+        static constexpr std::size_t kDefaultBufferBytes = 1 << 20;
+
+        /**
+         * @brief Construct deck of the records of a file
+         *
+         * Throws std::system_error if the file cannot be opened, and std::invalid_argument if its size is not
+         * a whole number of records
+         * @param[in] path File of records
+         * @param[in] bufferBytes Size of the block read at a time
+         */
+        explicit FileDeck(const std::string& path, std::size_t bufferBytes = kDefaultBufferBytes);
+
+        /**
+         * @brief Returns if every record has been dealt
+         */
+        bool empty() const { return mRemaining == 0; }
+
+        /**
+         * @brief Returns the number of records left to deal
+         */
+        std::uint64_t size() const { return mRemaining; }
+
+        /**
+         * @brief Returns the next record, removing it from the deck.
+         *
+         * Calling this method on an empty deck will throw an EmptyDeckException
+         */
+        T deal_card();
+
+        /**
+         * @brief Returns the next record, or no record if the deck is empty
+         */
+        std::optional<T> try_deal();
+
+    private:
+
+        /**
+         * @brief Reads the next block of records
+         */
+        void refill();
+
+        detail::BinaryFile mFile; /**<@brief File being dealt */
+        std::vector<T> mBuffer; /**<@brief Block of records read */
+        std::size_t mNext = 0; /**<@brief Index of the next record of mBuffer */
+        std::size_t mFilled = 0; /**<@brief Records of mBuffer read from the file */
+        std::uint64_t mRemaining = 0; /**<@brief Records left to deal */
+
+};
+
+namespace detail
+{
+
+/** @brief Most buckets each pass of an external shuffle splits into, to keep few files open */
+constexpr std::size_t kMaxExternalBuckets = 256;
+
+/** @brief Size of the blocks an external shuffle reads and writes */
+constexpr std::size_t kExternalBlockBytes = std::size_t(1) << 20;
+
+/** @brief Smallest write buffer of each bucket */
+constexpr std::size_t kMinBucketBufferBytes = std::size_t(64) << 10;
+
+/**
+ * @brief Returns the number of records of type T in a file, checking it holds whole records
+ */
+template <class T>
+std::uint64_t recordCount(const BinaryFile& file, const std::string& path)
+{
+    const std::uint64_t bytes = file.size();
+    if (bytes % sizeof(T) != 0)
+        throw std::invalid_argument(path + " is not a whole number of records");
+    return bytes / sizeof(T);
+}
+
+/**
+ * @brief Reads exactly count records
+ */
+template <class T>
+void readRecords(BinaryFile& file, T* records, std::size_t count)
+{
+    if (file.read(records, count * sizeof(T)) != count * sizeof(T))
+        throw std::runtime_error("BinaryFile: file ended before its last record");
+}
+
+/**
+ * @brief Shuffles records in memory, seeded from stream, and writes them out
+ */
+template <class T, class Rng>
+void shuffleAndWrite(std::vector<T>& records, const SeedStream& stream, BinaryFile& output)
+{
+    Rng generator;
+    SeedStream(stream).seed(generator);
+    knuthShuffle(records, generator);
+    output.write(records.data(), records.size() * sizeof(T));
+}
+
+/**
+ * @brief A temporary file of records sent to one bucket
+ */
+struct Bucket
+{
+    BinaryFile file; /**<@brief Records of the bucket */
+    std::uint64_t count = 0; /**<@brief Number of records */
+};
+
+/**
+ * @brief First pass: reads count records in order, appending each to a uniformly random bucket
+ * @return Buckets, each rewound to be read
+ */
+template <class T>
+std::vector<Bucket> partition(BinaryFile& input, std::uint64_t count, const SeedStream& stream,
+        const ExternalShuffleOptions& options, const std::string& directory)
+{
+    const std::uint64_t memoryRecords = std::max<std::size_t>(2, options.memoryBytes / sizeof(T));
+    const std::size_t buckets = static_cast<std::size_t>(std::min<std::uint64_t>(kMaxExternalBuckets,
+                std::max<std::uint64_t>(2, (2 * count + memoryRecords - 1) / memoryRecords)));
+    const std::size_t bufferBytes = std::clamp(options.memoryBytes / (2 * buckets), kMinBucketBufferBytes,
+            kExternalBlockBytes);
+    const std::size_t bufferRecords = std::max<std::size_t>(1, bufferBytes / sizeof(T));
+
+    std::vector<Bucket> bucketFiles(buckets);
+    for (auto& bucket : bucketFiles)
+        bucket.file = BinaryFile::temporary(directory);
+    std::vector<T> buffers(buckets * bufferRecords);
+    std::vector<std::size_t> buffered(buckets, 0);
+    std::vector<T> block(std::max<std::size_t>(1, kExternalBlockBytes / sizeof(T)));
+
+    Xoshiro256StarStar chooser;
+    stream.child(0).seed(chooser);
+    BoundedRandom<Xoshiro256StarStar> random(chooser);
+    for (std::uint64_t done = 0; done < count;)
+    {
+        const std::size_t records = static_cast<std::size_t>(std::min<std::uint64_t>(block.size(), count - done));
+        readRecords(input, block.data(), records);
+        for (std::size_t i = 0; i < records; i++)
+        {
+            const std::size_t bucket = random.below(static_cast<std::uint32_t>(buckets));
+            T* buffer = &buffers[bucket * bufferRecords];
+            buffer[buffered[bucket]++] = block[i];
+            if (buffered[bucket] == bufferRecords)
+            {
+                bucketFiles[bucket].file.write(buffer, bufferRecords * sizeof(T));
+                bucketFiles[bucket].count += bufferRecords;
+                buffered[bucket] = 0;
+            }
+        }
+        done += records;
+    }
+    for (std::size_t bucket = 0; bucket < buckets; bucket++)
+    {
+        bucketFiles[bucket].file.write(&buffers[bucket * bufferRecords], buffered[bucket] * sizeof(T));
+        bucketFiles[bucket].count += buffered[bucket];
+        bucketFiles[bucket].file.rewind();
+    }
+    return bucketFiles;
+}
+
+/**
+ * @brief Shuffles count records of input onto the end of output, splitting them into buckets if they do not
+ * fit in memory
+ */
+template <class T, class Rng>
+void shuffleInto(BinaryFile& input, std::uint64_t count, BinaryFile& output, const SeedStream& stream,
+        const ExternalShuffleOptions& options, const std::string& directory)
+{
+    if (count <= std::max<std::size_t>(2, options.memoryBytes / sizeof(T)))
+    {
+        std::vector<T> records(static_cast<std::size_t>(count));
+        readRecords(input, records.data(), records.size());
+        shuffleAndWrite<T, Rng>(records, stream, output);
+        return;
+    }
+
+    std::vector<Bucket> buckets = partition<T>(input, count, stream, options, directory);
+    for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+    {
+        shuffleInto<T, Rng>(buckets[bucket].file, buckets[bucket].count, output, stream.child(bucket + 1), options,
+                directory);
+        buckets[bucket].file.close();
+    }
+}
+
+} // namespace detail
+
+// Definition below
+template <class T, class Rng>
+void externalShuffle(const std::string& inputPath, const std::string& outputPath, SeedStream stream,
+        const ExternalShuffleOptions& options)
+{
+    static_assert(std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value,
+            "externalShuffle needs records that are trivially copyable and default constructible");
+    const std::string directory = options.tempDirectory.empty() ? detail::directoryOf(outputPath) :
+        options.tempDirectory;
+
+    // The input is read completely before the output is created, so the output can be the input
+    detail::BinaryFile input = detail::BinaryFile::openRead(inputPath);
+    const std::uint64_t count = detail::recordCount<T>(input, inputPath);
+    if (count <= std::max<std::size_t>(2, options.memoryBytes / sizeof(T)))
+    {
+        std::vector<T> records(static_cast<std::size_t>(count));
+        detail::readRecords(input, records.data(), records.size());
+        input.close();
+        detail::BinaryFile output = detail::BinaryFile::create(outputPath);
+        detail::shuffleAndWrite<T, Rng>(records, stream, output);
+        return;
+    }
+
+    std::vector<detail::Bucket> buckets = detail::partition<T>(input, count, stream, options, directory);
+    input.close();
+    detail::BinaryFile output = detail::BinaryFile::create(outputPath);
+    for (std::size_t bucket = 0; bucket < buckets.size(); bucket++)
+    {
+        detail::shuffleInto<T, Rng>(buckets[bucket].file, buckets[bucket].count, output, stream.child(bucket + 1),
+                options, directory);
+        buckets[bucket].file.close();
+    }
+}
+
+template <class T>
+FileDeck<T>::FileDeck(const std::string& path, std::size_t bufferBytes) :
+    mFile(detail::BinaryFile::openRead(path)),
+    mBuffer(std::max<std::size_t>(1, bufferBytes / sizeof(T)))
+{
+    static_assert(std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value,
+            "FileDeck needs records that are trivially copyable and default constructible");
+    mRemaining = detail::recordCount<T>(mFile, path);
+}
+
+template <class T>
+T FileDeck<T>::deal_card()
+{
+    if (mRemaining == 0)
+        throw EmptyDeckException();
+    if (mNext == mFilled)
+        refill();
+    mRemaining--;
+    return mBuffer[mNext++];
+}
+
+template <class T>
+std::optional<T> FileDeck<T>::try_deal()
+{
+    if (mRemaining == 0)
+        return std::nullopt;
+    return deal_card();
+}
+
+template <class T>
+void FileDeck<T>::refill()
+{
+    mFilled = static_cast<std::size_t>(std::min<std::uint64_t>(mBuffer.size(), mRemaining));
+    detail::readRecords(mFile, mBuffer.data(), mFilled);
+    mNext = 0;
+}
+
+} // namespace doc
+#endif
@@ -0,0 +1,241 @@
+/**
+ * @file instrumentation.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare per-thread hot path counters for Deck and WarCardGame, compiled in only when DOC_INSTRUMENTATION
+ * is defined.
+ */
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(DOC_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @brief Counts of the work done on one thread. Subtract two snapshots to get the counts between them.
+ */
+struct InstrumentationCounters
+{
+    std::uint64_t deals = 0; /**<@brief Cards dealt from a Deck */
+    std::uint64_t shuffles = 0; /**<@brief Calls to Deck::shuffle(), eager or lazy */
+    std::uint64_t shuffledElements = 0; /**<@brief Cards moved into place by Fisher-Yates steps */
+    std::uint64_t reshuffles = 0; /**<@brief Win piles that became decks in WarCardGame::replenishDecks() */
+    std::uint64_t wars = 0; /**<@brief Calls to WarCardGame::war(), counting each recursion */
+    std::uint64_t deepestWarOnThread = 0; /**<@brief High-water mark of war() nesting on this thread. Not subtracted. */
+    std::uint64_t allocations = 0; /**<@brief Calls to operator new, if the allocation hook is linked in */
+    std::uint64_t allocatedBytes = 0; /**<@brief Bytes requested from operator new, if the hook is linked in */
+    std::uint64_t turns = 0; /**<@brief Turns played by WarCardGame */
+    std::uint64_t timedTurns = 0; /**<@brief Turns whose duration was sampled */
+    std::uint64_t timedTurnTicks = 0; /**<@brief Ticks (see instrumentation::ticks()) spent in sampled turns */
+
+    /**
+     * @brief Returns the mean ticks per turn of the sampled turns, or 0 if none were sampled
+     */
+    double ticksPerTurn() const
+    {
+        return timedTurns == 0 ? 0.0 : static_cast<double>(timedTurnTicks) / timedTurns;
+    }
+
+    /**
+     * @brief Adds the counts of another thread's counters
+     */
+    InstrumentationCounters& operator+=(const InstrumentationCounters& other);
+};
+
+/**
+ * @brief Returns the counts in later that are not in earlier, keeping later's deepestWarOnThread
+ */
+InstrumentationCounters operator-(InstrumentationCounters later, const InstrumentationCounters& earlier);
+
+/**
+ * @brief Hot path instrumentation.
+ *
+ * Configure with -DDOC_INSTRUMENTATION=ON (or define DOC_INSTRUMENTATION) to compile the counters in. Without
+ * it, DOC_COUNT and the scope classes compile to nothing, and snapshot() always returns zeros. Counters are
+ * thread_local, so counting never contends between threads; a thread reads its own counters with snapshot().
+ *
+ * Allocations are counted by the replacement operator new in src/instrumentation.cpp, in programs that link
+ * it and are built with DOC_INSTRUMENTATION.
+ *
+ * DOC_INSTRUMENTATION changes the bodies of inline and template functions such as Deck::deal(), so every
+ * translation unit of a program must agree on it, or the program breaks the one definition rule. Set it with
+ * the CMake option, which defines it for every target, rather than in single sources or targets.
+ */
+namespace instrumentation
+{
+
+/** @brief If the counters are compiled in */
+#ifdef DOC_INSTRUMENTATION
+constexpr bool kEnabled = true;
+#else
+constexpr bool kEnabled = false;
+#endif
+
+/** @brief One in this many turns is timed, so reading the clock does not slow every turn */
+constexpr std::uint64_t kTurnSampleInterval = 16;
+
+/**
+ * @brief Returns this thread's counters, for updating
+ */
+inline InstrumentationCounters& threadCounters()
+{
+    static thread_local InstrumentationCounters counters;
+    return counters;
+}
+
+/**
+ * @brief Returns a copy of this thread's counters
+ */
+inline InstrumentationCounters snapshot()
+{
+    return threadCounters();
+}
+
+/**
+ * @brief Sets this thread's counters to zero
+ */
+inline void reset()
+{
+    threadCounters() = InstrumentationCounters();
+}
+
+/**
+ * @brief Returns a fast timestamp: the CPU's time stamp counter on x86, or steady_clock nanoseconds otherwise
+ */
+inline std::uint64_t ticks()
+{
+#if defined(DOC_INSTRUMENTATION) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+#ifdef DOC_INSTRUMENTATION
+
+/**
+ * @brief Counts a turn for as long as it is in scope, and times one turn in every kTurnSampleInterval
+ */
+class TurnScope
+{
+    public:
+        TurnScope() : mCounters(threadCounters())
+        {
+            mSampled = ++mCounters.turns % kTurnSampleInterval == 0;
+            if (mSampled)
+                mStart = ticks();
+        }
+
+        ~TurnScope()
+        {
+            if (mSampled)
+            {
+                mCounters.timedTurnTicks += ticks() - mStart;
+                mCounters.timedTurns++;
+            }
+        }
+
+        TurnScope(const TurnScope&) = delete;
+        TurnScope& operator=(const TurnScope&) = delete;
+
+    private:
+        InstrumentationCounters& mCounters; /**<@brief This thread's counters */
+        bool mSampled = false; /**<@brief If this turn is timed */
+        std::uint64_t mStart = 0; /**<@brief Ticks when the turn started */
+};
+
+/**
+ * @brief Counts a war for as long as it is in scope, tracking how deeply wars are nested
+ */
+class WarScope
+{
+    public:
+        WarScope() : mCounters(threadCounters())
+        {
+            mCounters.wars++;
+            if (++sDepth > mCounters.deepestWarOnThread)
+                mCounters.deepestWarOnThread = sDepth;
+        }
+
+        ~WarScope() { sDepth--; }
+
+        WarScope(const WarScope&) = delete;
+        WarScope& operator=(const WarScope&) = delete;
+
+    private:
+        InstrumentationCounters& mCounters; /**<@brief This thread's counters */
+        static inline thread_local std::uint64_t sDepth = 0; /**<@brief Wars nested on this thread right now */
+};
+
+/** @brief Adds amount to this thread's counter field */
+#define DOC_COUNT(field, amount) (::doc::instrumentation::threadCounters().field += (amount))
+
+#else
+
+class TurnScope
+{
+    public:
+        TurnScope() {}
+};
+
+class WarScope
+{
+    public:
+        WarScope() {}
+};
+
+#define DOC_COUNT(field, amount) ((void)0)
+
+#endif
+
+} // namespace instrumentation
+
+inline InstrumentationCounters& InstrumentationCounters::operator+=(const InstrumentationCounters& other)
+{
+    deals += other.deals;
+    shuffles += other.shuffles;
+    shuffledElements += other.shuffledElements;
+    reshuffles += other.reshuffles;
+    wars += other.wars;
+    if (other.deepestWarOnThread > deepestWarOnThread)
+        deepestWarOnThread = other.deepestWarOnThread;
+    allocations += other.allocations;
+    allocatedBytes += other.allocatedBytes;
+    turns += other.turns;
+    timedTurns += other.timedTurns;
+    timedTurnTicks += other.timedTurnTicks;
+    return *this;
+}
+
+inline InstrumentationCounters operator-(InstrumentationCounters later, const InstrumentationCounters& earlier)
+{
+    later.deals -= earlier.deals;
+    later.shuffles -= earlier.shuffles;
+    later.shuffledElements -= earlier.shuffledElements;
+    later.reshuffles -= earlier.reshuffles;
+    later.wars -= earlier.wars;
+    later.allocations -= earlier.allocations;
+    later.allocatedBytes -= earlier.allocatedBytes;
+    later.turns -= earlier.turns;
+    later.timedTurns -= earlier.timedTurns;
+    later.timedTurnTicks -= earlier.timedTurnTicks;
+    return later;
+}
+
+} // namespace doc
+#endif
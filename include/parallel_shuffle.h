@@ -0,0 +1,204 @@
+/**
+ * @file parallel_shuffle.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare parallelShuffle, a bucket shuffle that shuffles very large data across a ThreadPool, and
+ * define Deck::shuffle(const ParallelPolicy&) with it.
+ */
+
+#ifndef PARALLEL_SHUFFLE_H
+#define PARALLEL_SHUFFLE_H
+
+#include "bounded_random.h"
+#include "deck.h"
+#include "instrumentation.h"
+#include "seed_stream.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @brief How a parallel shuffle is divided between threads (see parallelShuffle())
+ */
+struct ParallelPolicy
+{
+    /** @brief Number of blocks the data is split into, and of threads started if there is no pool. 0 uses the
+     * pool's size, or one per hardware thread. */
+    unsigned int threads = 0;
+
+    /** @brief Pool to run on, so threads are not started for each shuffle. nullptr starts threads to shuffle. */
+    ThreadPool* pool = nullptr;
+
+    /** @brief Smaller data is shuffled by knuthShuffle() on the calling thread */
+    std::size_t minParallelSize = std::size_t(1) << 17;
+};
+
+namespace detail
+{
+
+/** @brief Size a bucket of a parallel shuffle is aimed at, so it is shuffled within the cache */
+constexpr std::size_t kParallelBucketBytes = std::size_t(1) << 20;
+
+/**
+ * @brief Contiguous elements, with the size() and operator[] knuthShuffle() needs
+ */
+template <class T>
+struct ShuffleSpan
+{
+    T* data; /**<@brief First element */
+    std::size_t count; /**<@brief Number of elements */
+
+    std::size_t size() const { return count; }
+    T& operator[](std::size_t index) const { return data[index]; }
+};
+
+/**
+ * @brief Frees uninitialized memory from std::allocator
+ */
+template <class T>
+struct DeallocateBuffer
+{
+    std::size_t count; /**<@brief Number of elements allocated */
+
+    void operator()(T* buffer) const { std::allocator<T>().deallocate(buffer, count); }
+};
+
+} // namespace detail
+
+/**
+ * @brief Parallel bucket shuffle, producing a uniformly random permutation of data across many threads.
+ *
+ * The data is split into one contiguous block per thread, and each element is sent to a bucket chosen
+ * uniformly at random. Blocks count their elements' buckets in parallel, then scatter them, in parallel, into
+ * a buffer laid out bucket by bucket. Each bucket is then shuffled with knuthShuffle() and moved back. Since
+ * every element picks its bucket independently, and every bucket is uniformly permuted, every permutation is
+ * equally likely. There are enough buckets for each to hold about 1 MiB, so they are shuffled within the cache,
+ * and at least one per block.
+ *
+ * Each block and bucket has its own generator, seeded from a SeedStream drawn from randomGenerator, so the
+ * result depends only on randomGenerator's state, the number of blocks (policy.threads) and the size of the
+ * data, and not on which threads run which block. Data smaller than policy.minParallelSize, a single block, or
+ * elements whose moves can throw are shuffled by knuthShuffle() on the calling thread.
+ *
+ * Needs a buffer of data.size() elements, allocated for the shuffle, and a count for each block and bucket.
+ *
+ * @param[in] data Data to shuffle. Any container with size() and operator[].
+ * @param[in] randomGenerator Any UniformRandomBitGenerator that can be default constructed and seeded with
+ *  seed(value), such as std::mt19937 or one of the engines in random_engines.h.
+ * @param[in] policy Number of blocks and the pool to run on
+ */
+template <class Container, class Rng>
+void parallelShuffle(Container& data, Rng& randomGenerator, const ParallelPolicy& policy)
+{
+    using T = std::remove_reference_t<decltype(data[0])>;
+    const std::size_t size = data.size();
+    unsigned int blocks = policy.threads;
+    if (blocks == 0)
+        blocks = policy.pool != nullptr ? policy.pool->size() : std::max(1u, std::thread::hardware_concurrency());
+    if (blocks < 2 || size < policy.minParallelSize || size < blocks ||
+        !std::is_nothrow_move_constructible<T>::value || !std::is_nothrow_move_assignable<T>::value)
+    {
+        knuthShuffle(data, randomGenerator);
+        return;
+    }
+
+    std::optional<ThreadPool> ownPool;
+    ThreadPool* pool = policy.pool;
+    if (pool == nullptr)
+        pool = &ownPool.emplace(blocks);
+
+    const std::size_t perBucket = std::max<std::size_t>(1, detail::kParallelBucketBytes / sizeof(T));
+    const std::size_t buckets = std::max<std::size_t>(blocks, (size + perBucket - 1) / perBucket);
+    const SeedStream streams(std::uniform_int_distribution<std::uint64_t>()(randomGenerator));
+    std::vector<Rng> blockGenerators(blocks);
+    for (unsigned int block = 0; block < blocks; block++)
+        streams.child(block).seed(blockGenerators[block]);
+    auto blockBegin = [size, blocks](std::size_t block)
+    {
+        return size / blocks * block + std::min<std::size_t>(block, size % blocks);
+    };
+
+    // Count the elements each block sends to each bucket. The choices are drawn again, from a copy of the same
+    // generator, to scatter, rather than stored.
+    std::vector<std::size_t> next(std::size_t(blocks) * buckets, 0);
+    pool->run(blocks, [&](std::size_t block)
+    {
+        Rng generator = blockGenerators[block];
+        BoundedRandom<Rng> random(generator);
+        std::size_t* counts = &next[block * buckets];
+        for (std::size_t i = blockBegin(block), end = blockBegin(block + 1); i < end; i++)
+            counts[random.below(static_cast<std::uint32_t>(buckets))]++;
+    });
+
+    // Lay the buffer out bucket by bucket, and within each bucket block by block
+    std::vector<std::size_t> bucketBegin(buckets + 1);
+    std::size_t position = 0;
+    for (std::size_t bucket = 0; bucket < buckets; bucket++)
+    {
+        bucketBegin[bucket] = position;
+        for (std::size_t block = 0; block < blocks; block++)
+        {
+            const std::size_t count = next[block * buckets + bucket];
+            next[block * buckets + bucket] = position;
+            position += count;
+        }
+    }
+    bucketBegin[buckets] = size;
+
+    std::unique_ptr<T, detail::DeallocateBuffer<T>> buffer(std::allocator<T>().allocate(size),
+            detail::DeallocateBuffer<T>{size});
+    pool->run(blocks, [&](std::size_t block)
+    {
+        Rng generator = blockGenerators[block];
+        BoundedRandom<Rng> random(generator);
+        std::size_t* positions = &next[block * buckets];
+        for (std::size_t i = blockBegin(block), end = blockBegin(block + 1); i < end; i++)
+        {
+            T* slot = buffer.get() + positions[random.below(static_cast<std::uint32_t>(buckets))]++;
+            ::new (static_cast<void*>(slot)) T(std::move(data[i]));
+        }
+    });
+
+    pool->run(buckets, [&](std::size_t bucket)
+    {
+        const std::size_t begin = bucketBegin[bucket];
+        const std::size_t count = bucketBegin[bucket + 1] - begin;
+        Rng generator;
+        streams.child(blocks + bucket).seed(generator);
+        detail::ShuffleSpan<T> span{buffer.get() + begin, count};
+        knuthShuffle(span, generator);
+        for (std::size_t i = 0; i < count; i++)
+            data[begin + i] = std::move(span[i]);
+        std::destroy_n(span.data, count);
+    });
+}
+
+// Definition below
+template<class T, class Rng, class Storage>
+void Deck<T, Rng, Storage>::shuffle(const ParallelPolicy& policy)
+{
+    DOC_COUNT(shuffles, 1);
+    DOC_COUNT(shuffledElements, mData.size());
+    mShufflePending = false;
+    parallelShuffle(mData, mRandomGen, policy);
+}
+
+} // namespace doc
+#endif
@@ -12,8 +12,12 @@
 #ifndef PLAYING_CARD_H
 #define PLAYING_CARD_H
 
-#include <vector>
+#include <array>
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 /**
  * @brief "Deck of Cards" namespace
@@ -21,6 +25,17 @@
 namespace doc
 {
 
+namespace detail
+{
+
+/** @brief Names of the suites, in the order of PlayingCard::Suite */
+inline constexpr std::string_view kSuiteNames[] = {"Clubs", "Diamonds", "Hearts", "Spades"};
+
+/** @brief Names of the ranks, in the order of PlayingCard::Rank, Ace first */
+inline constexpr std::string_view kRankNames[] = {"A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"};
+
+} // namespace detail
+
 /**
  * @class PlayingCard "playing_card.h" "playing_card.h"
  * 
@@ -52,6 +67,28 @@ class PlayingCard
          */
         static std::string toString(const Rank rank);
 
+        /**
+         * @brief Returns the name of a suite, as toString() does, without allocating
+         * @param[in] suite
+         * @return Name of suite, or an empty view if suite is not one of the four
+         */
+        static constexpr std::string_view name(const Suite suite)
+        {
+            const int index = static_cast<int>(suite);
+            return index >= 0 && index < 4 ? detail::kSuiteNames[index] : std::string_view();
+        }
+
+        /**
+         * @brief Returns the name of a rank, as toString() does, without allocating
+         * @param[in] rank
+         * @return Name of rank, or an empty view if rank is not one of the thirteen
+         */
+        static constexpr std::string_view name(const Rank rank)
+        {
+            const int index = static_cast<int>(rank) - 1;
+            return index >= 0 && index < 13 ? detail::kRankNames[index] : std::string_view();
+        }
+
         /**
          * @brief Return the underlying int value for a Rank enum.
          * Ace is low (Ace == 1)
@@ -64,19 +101,19 @@ class PlayingCard
          * @param[in] suite One of four suites
          * @param[in] rank One of thirteen ranks
          */
-        PlayingCard(const Suite suite, const Rank rank);
+        constexpr PlayingCard(const Suite suite, const Rank rank) : mSuite(suite), mRank(rank) {}
 
         /**
          * @brief Returns the playing card's suite
          * @return suite
          */
-        Suite suite() const;
+        constexpr Suite suite() const { return mSuite; }
 
         /**
          * @brief Returns the playing card's rank
          * @return rank 
          */
-        Rank rank() const;
+        constexpr Rank rank() const { return mRank; }
 
         /**
          * @brief Returns the card's suite and rank within a string.
@@ -84,6 +121,26 @@ class PlayingCard
          */
         std::string str() const;
 
+        /** @brief Most characters formatTo() writes, for "10 Diamonds" */
+        static constexpr std::size_t kMaxFormattedLength = 11;
+
+        /**
+         * @brief Writes the card's rank and suite, as str() returns them, without allocating
+         * @param[in] out Buffer with room for at least kMaxFormattedLength characters. No terminating null
+         * character is written.
+         * @return Number of characters written
+         */
+        constexpr std::size_t formatTo(char* out) const
+        {
+            std::size_t length = 0;
+            for (const char character : name(mRank))
+                out[length++] = character;
+            out[length++] = ' ';
+            for (const char character : name(mSuite))
+                out[length++] = character;
+            return length;
+        }
+
     private:
         Suite mSuite; /**<@brief Playing Card's suite */
         Rank mRank; /**<@brief Playing Card's rank */
@@ -92,5 +149,36 @@ class PlayingCard
 
 std::vector<PlayingCard> buildStandardDeck();
 
+namespace detail
+{
+
+/**
+ * @brief Returns card index of a standard deck, in the order of buildStandardDeck()
+ */
+template <class Card>
+constexpr Card standardDeckCard(std::size_t index)
+{
+    return Card(static_cast<PlayingCard::Suite>(index / 13), static_cast<PlayingCard::Rank>(13 - index % 13));
+}
+
+template <class Card, std::size_t... Index>
+constexpr std::array<Card, sizeof...(Index)> buildStandardDeckArray(std::index_sequence<Index...>)
+{
+    return {{standardDeckCard<Card>(Index)...}};
+}
+
+} // namespace detail
+
+/**
+ * @brief Returns the cards of buildStandardDeck(), in the same order, as an array that can be built at compile
+ * time and needs no allocation
+ * @tparam Card Card type, constructible from a suite and a rank, such as PlayingCard or CompactCard
+ */
+template <class Card = PlayingCard>
+constexpr std::array<Card, 52> buildStandardDeckArray()
+{
+    return detail::buildStandardDeckArray<Card>(std::make_index_sequence<52>());
+}
+
 } // namespace doc
 #endif
@@ -0,0 +1,360 @@
+/**
+ * @file random_engines.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare small, fast pseudo-random number generators for shuffling: SplitMix64, Xoshiro256StarStar,
+ * and Pcg32.
+ *
+ */
+
+#ifndef RANDOM_ENGINES_H
+#define RANDOM_ENGINES_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class SplitMix64 "random_engines.h" "random_engines.h"
+ *
+ * @brief SplitMix64 generator, with 8 bytes of state. See https://prng.di.unimi.it/splitmix64.c
+ *
+ * Its state advances by a constant each step, so it can jump ahead any number of steps in O(1) with discard().
+ * It is mostly used to expand one seed into the seeds of other generators.
+ *
+ * Meets the requirements of UniformRandomBitGenerator, producing 64-bit values.
+ */
+class SplitMix64
+{
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        /**
+         * @brief Construct generator with a seed
+         * @param[in] value Seed, any value is valid
+         */
+        explicit SplitMix64(std::uint64_t value = 0) : mState(value) {}
+
+        /**
+         * @brief Re-seed the generator
+         * @param[in] value Seed, any value is valid
+         */
+        void seed(std::uint64_t value) { mState = value; }
+
+        /**
+         * @brief Returns the next random value
+         */
+        result_type operator()()
+        {
+            mState += kGamma;
+            std::uint64_t z = mState;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        /**
+         * @brief Skip ahead a number of values, in O(1)
+         * @param[in] steps Number of values to skip
+         */
+        void discard(unsigned long long steps) { mState += kGamma * steps; }
+
+        /**
+         * @brief Returns the generator's state, which setState() restores
+         */
+        std::uint64_t state() const { return mState; }
+
+        /**
+         * @brief Restore a state returned by state()
+         * @param[in] value Generator state, any value is valid
+         */
+        void setState(std::uint64_t value) { mState = value; }
+
+        bool operator==(const SplitMix64& other) const { return mState == other.mState; }
+        bool operator!=(const SplitMix64& other) const { return mState != other.mState; }
+
+    private:
+        static constexpr std::uint64_t kGamma = 0x9e3779b97f4a7c15ULL; /**<@brief Step between states */
+
+        std::uint64_t mState; /**<@brief Generator state */
+};
+
+/**
+ * @class Xoshiro256StarStar "random_engines.h" "random_engines.h"
+ *
+ * @brief xoshiro256** generator, with 32 bytes of state and a period of 2^256 - 1.
+ * See https://prng.di.unimi.it/xoshiro256starstar.c
+ *
+ * jump() advances the generator 2^128 steps, so generators seeded the same way and jumped a different
+ * number of times produce non-overlapping streams, one per deck or thread. long_jump() advances 2^192 steps.
+ *
+ * Meets the requirements of UniformRandomBitGenerator, producing 64-bit values.
+ */
+class Xoshiro256StarStar
+{
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        /**
+         * @brief Construct generator with a seed
+         * @param[in] value Seed, any value is valid. It is expanded into the full state with SplitMix64.
+         */
+        explicit Xoshiro256StarStar(std::uint64_t value = 0) { seed(value); }
+
+        /**
+         * @brief Re-seed the generator
+         * @param[in] value Seed, any value is valid. It is expanded into the full state with SplitMix64.
+         */
+        void seed(std::uint64_t value)
+        {
+            SplitMix64 expander(value);
+            for (auto& word : mState)
+                word = expander();
+        }
+
+        /**
+         * @brief Returns the next random value
+         */
+        result_type operator()()
+        {
+            const std::uint64_t result = rotl(mState[1] * 5, 7) * 9;
+            const std::uint64_t t = mState[1] << 17;
+            mState[2] ^= mState[0];
+            mState[3] ^= mState[1];
+            mState[1] ^= mState[2];
+            mState[0] ^= mState[3];
+            mState[2] ^= t;
+            mState[3] = rotl(mState[3], 45);
+            return result;
+        }
+
+        /**
+         * @brief Skip ahead a number of values
+         * @param[in] steps Number of values to skip
+         */
+        void discard(unsigned long long steps)
+        {
+            for (; steps > 0; steps--)
+                (*this)();
+        }
+
+        /**
+         * @brief Advance the generator 2^128 steps
+         */
+        void jump()
+        {
+            static const std::uint64_t kJump[] = {
+                0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+            jumpBy(kJump);
+        }
+
+        /**
+         * @brief Advance the generator 2^192 steps
+         */
+        void long_jump()
+        {
+            static const std::uint64_t kLongJump[] = {
+                0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL};
+            jumpBy(kLongJump);
+        }
+
+        /**
+         * @brief Returns the generator's state, which setState() restores
+         */
+        std::array<std::uint64_t, 4> state() const { return {mState[0], mState[1], mState[2], mState[3]}; }
+
+        /**
+         * @brief Restore a state returned by state()
+         *
+         * Throws std::invalid_argument if every word is zero, which is not a valid state
+         * @param[in] value Generator state
+         */
+        void setState(const std::array<std::uint64_t, 4>& value)
+        {
+            if ((value[0] | value[1] | value[2] | value[3]) == 0)
+                throw std::invalid_argument("Xoshiro256StarStar state must not be all zero");
+            for (int i = 0; i < 4; i++)
+                mState[i] = value[i];
+        }
+
+        bool operator==(const Xoshiro256StarStar& other) const
+        {
+            return mState[0] == other.mState[0] && mState[1] == other.mState[1] &&
+                mState[2] == other.mState[2] && mState[3] == other.mState[3];
+        }
+        bool operator!=(const Xoshiro256StarStar& other) const { return !(*this == other); }
+
+    private:
+
+        static std::uint64_t rotl(const std::uint64_t x, int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        /**
+         * @brief Advance the generator by the jump polynomial
+         */
+        void jumpBy(const std::uint64_t (&polynomial)[4])
+        {
+            std::uint64_t jumped[4] = {0, 0, 0, 0};
+            for (const std::uint64_t word : polynomial)
+            {
+                for (int bit = 0; bit < 64; bit++)
+                {
+                    if (word & (std::uint64_t(1) << bit))
+                    {
+                        for (int i = 0; i < 4; i++)
+                            jumped[i] ^= mState[i];
+                    }
+                    (*this)();
+                }
+            }
+            for (int i = 0; i < 4; i++)
+                mState[i] = jumped[i];
+        }
+
+        std::uint64_t mState[4]; /**<@brief Generator state, never all zero */
+};
+
+/**
+ * @class Pcg32 "random_engines.h" "random_engines.h"
+ *
+ * @brief PCG32 (XSH RR) generator, with 16 bytes of state. See https://www.pcg-random.org
+ *
+ * Each odd increment selects one of 2^63 independent streams, and advance() jumps ahead any number of steps
+ * in O(log n).
+ *
+ * Meets the requirements of UniformRandomBitGenerator, producing 32-bit values.
+ */
+class Pcg32
+{
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        /**
+         * @brief Construct generator with a seed and stream
+         * @param[in] value Seed, any value is valid
+         * @param[in] stream Stream to use, any value is valid
+         */
+        explicit Pcg32(std::uint64_t value = 0x853c49e6748fea9bULL, std::uint64_t stream = 0xda3e39cb94b95bdbULL)
+        {
+            seed(value, stream);
+        }
+
+        /**
+         * @brief Re-seed the generator, keeping its stream
+         * @param[in] value Seed, any value is valid
+         */
+        void seed(std::uint64_t value) { seed(value, mIncrement >> 1); }
+
+        /**
+         * @brief Re-seed the generator and select its stream
+         * @param[in] value Seed, any value is valid
+         * @param[in] stream Stream to use, any value is valid
+         */
+        void seed(std::uint64_t value, std::uint64_t stream)
+        {
+            mState = 0;
+            mIncrement = (stream << 1) | 1;
+            step();
+            mState += value;
+            step();
+        }
+
+        /**
+         * @brief Returns the next random value
+         */
+        result_type operator()()
+        {
+            const std::uint64_t previous = mState;
+            step();
+            const std::uint32_t xorshifted = static_cast<std::uint32_t>(((previous >> 18) ^ previous) >> 27);
+            const std::uint32_t rotation = static_cast<std::uint32_t>(previous >> 59);
+            return (xorshifted >> rotation) | (xorshifted << ((32 - rotation) & 31));
+        }
+
+        /**
+         * @brief Skip ahead a number of values, in O(log n)
+         * @param[in] steps Number of values to skip
+         */
+        void advance(std::uint64_t steps)
+        {
+            std::uint64_t multiplier = kMultiplier;
+            std::uint64_t increment = mIncrement;
+            std::uint64_t totalMultiplier = 1;
+            std::uint64_t totalIncrement = 0;
+            while (steps > 0)
+            {
+                if (steps & 1)
+                {
+                    totalMultiplier *= multiplier;
+                    totalIncrement = totalIncrement * multiplier + increment;
+                }
+                increment = (multiplier + 1) * increment;
+                multiplier *= multiplier;
+                steps >>= 1;
+            }
+            mState = totalMultiplier * mState + totalIncrement;
+        }
+
+        /**
+         * @brief Skip ahead a number of values, in O(log n). Same as advance().
+         * @param[in] steps Number of values to skip
+         */
+        void discard(unsigned long long steps) { advance(steps); }
+
+        /**
+         * @brief Returns the generator's state and increment, which setState() restores
+         */
+        std::array<std::uint64_t, 2> state() const { return {mState, mIncrement}; }
+
+        /**
+         * @brief Restore a state returned by state()
+         *
+         * Throws std::invalid_argument if the increment is even, which is not a valid state
+         * @param[in] value Generator state and increment
+         */
+        void setState(const std::array<std::uint64_t, 2>& value)
+        {
+            if ((value[1] & 1) == 0)
+                throw std::invalid_argument("Pcg32 increment must be odd");
+            mState = value[0];
+            mIncrement = value[1];
+        }
+
+        bool operator==(const Pcg32& other) const
+        {
+            return mState == other.mState && mIncrement == other.mIncrement;
+        }
+        bool operator!=(const Pcg32& other) const { return !(*this == other); }
+
+    private:
+        static constexpr std::uint64_t kMultiplier = 6364136223846793005ULL; /**<@brief LCG multiplier */
+
+        void step() { mState = mState * kMultiplier + mIncrement; }
+
+        std::uint64_t mState = 0; /**<@brief LCG state */
+        std::uint64_t mIncrement = 1; /**<@brief LCG increment, always odd, selects the stream */
+};
+
+} // namespace doc
+#endif
@@ -0,0 +1,201 @@
+/**
+ * @file reservoir_sampler.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare ReservoirSampler class, that keeps a uniformly random sample of a stream of cards whose length
+ * is not known in advance.
+ */
+
+#ifndef RESERVOIR_SAMPLER_H
+#define RESERVOIR_SAMPLER_H
+
+#include "bounded_random.h"
+#include "seed_stream.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class ReservoirSampler "reservoir_sampler.h" "reservoir_sampler.h"
+ * @brief Keeps a uniformly random sample of count cards from a stream, such as the records dealt by a FileDeck,
+ * in O(count) memory.
+ *
+ * Uses Li's Algorithm L (https://doi.org/10.1145/198429.198435): rather than drawing a random number for every
+ * card, it draws how many cards to skip before the next one that enters the sample. A stream of n cards costs
+ * O(count (1 + log(n / count))) random numbers, and each skipped card only a comparison.
+ *
+ * After any number of cards, every set of count of them (or all of them, if fewer) is equally likely to be the
+ * sample. The order of the sample is not random; shuffle it if that matters.
+ *
+ * A sampler constructed without a seed is seeded from its thread's SeedStream (see seeding::threadStream()), like
+ * Deck and Shoe.
+ */
+template <class T, class Rng = std::mt19937>
+class ReservoirSampler
+{
+    public:
+
+        /**
+         * @brief Construct sampler keeping count cards, seeded from this thread's SeedStream
+         * @param[in] count Size of the sample
+         */
+        explicit ReservoirSampler(std::size_t count);
+
+        /**
+         * @brief Construct sampler keeping count cards
+         * @param[in] count Size of the sample
+         * @param[in] seed Seed for the random number generator
+         */
+        ReservoirSampler(std::size_t count, typename Rng::result_type seed);
+
+        /**
+         * @brief Construct sampler keeping count cards, with a stream to seed its random number generator from
+         * @param[in] count Size of the sample
+         * @param[in] stream Stream of seeds (see SeedStream::seed())
+         */
+        ReservoirSampler(std::size_t count, SeedStream stream);
+
+        /**
+         * @brief No copy constructor to prevent multiple samplers using the same seeded random number generator
+         */
+        ReservoirSampler(const ReservoirSampler&) = delete;
+
+        /**
+         * @brief No copy assignment operator to prevent multiple samplers using the same seeded random generator
+         */
+        ReservoirSampler& operator=(const ReservoirSampler&) = delete;
+
+        /**
+         * @brief Adds the next card of the stream
+         * @param[in] card Card, copied or moved into the sample if it is chosen
+         */
+        template <class Card>
+        void add(Card&& card);
+
+        /**
+         * @brief Adds every card of a range, in order
+         */
+        template <class InputIt>
+        void add(InputIt first, InputIt last);
+
+        /**
+         * @brief Returns the sample of the cards added so far
+         */
+        const std::vector<T>& sample() const { return mSample; }
+
+        /**
+         * @brief Returns the sample, moving it out of the sampler
+         */
+        std::vector<T> take() { return std::move(mSample); }
+
+        /**
+         * @brief Returns the number of cards added
+         */
+        std::uint64_t seen() const { return mSeen; }
+
+    private:
+
+        /**
+         * @brief Returns a uniformly distributed number in (0, 1)
+         */
+        double uniform();
+
+        /**
+         * @brief Draws the number of the next card to enter the sample
+         */
+        void drawNext();
+
+        std::size_t mCount; /**<@brief Size of the sample */
+        Rng mRandomGen; /**<@brief Chooses the cards of the sample */
+        BoundedRandom<Rng> mRandom{mRandomGen}; /**<@brief Draws from mRandomGen which card each new one replaces */
+        std::vector<T> mSample; /**<@brief Cards chosen so far */
+        std::uint64_t mSeen = 0; /**<@brief Number of cards added */
+        std::uint64_t mNext = 0; /**<@brief Number of the next card to enter the sample, once it is full */
+        double mWeight = 1.0; /**<@brief Algorithm L's W: the largest of the sample's random keys */
+
+};
+
+// Definition below
+template <class T, class Rng>
+ReservoirSampler<T, Rng>::ReservoirSampler(std::size_t count) :
+    ReservoirSampler(count, seeding::threadStream().split())
+{
+}
+
+template <class T, class Rng>
+ReservoirSampler<T, Rng>::ReservoirSampler(std::size_t count, typename Rng::result_type seed) :
+    mCount(count), mRandomGen(seed)
+{
+    mSample.reserve(count);
+}
+
+template <class T, class Rng>
+ReservoirSampler<T, Rng>::ReservoirSampler(std::size_t count, SeedStream stream) :
+    mCount(count)
+{
+    stream.seed(mRandomGen);
+    mSample.reserve(count);
+}
+
+template <class T, class Rng>
+template <class Card>
+void ReservoirSampler<T, Rng>::add(Card&& card)
+{
+    if (mSample.size() < mCount)
+    {
+        mSample.emplace_back(std::forward<Card>(card));
+        if (mSample.size() == mCount)
+        {
+            mWeight = std::exp(std::log(uniform()) / mCount);
+            drawNext();
+        }
+    }
+    else if (mSeen == mNext && mCount > 0)
+    {
+        mSample[mRandom.below(std::uint64_t(mCount))] = std::forward<Card>(card);
+        mWeight *= std::exp(std::log(uniform()) / mCount);
+        drawNext();
+    }
+    mSeen++;
+}
+
+template <class T, class Rng>
+template <class InputIt>
+void ReservoirSampler<T, Rng>::add(InputIt first, InputIt last)
+{
+    for (; first != last; ++first)
+        add(*first);
+}
+
+template <class T, class Rng>
+double ReservoirSampler<T, Rng>::uniform()
+{
+    const std::uint64_t bits = std::uniform_int_distribution<std::uint64_t>()(mRandomGen) >> 11;
+    return (static_cast<double>(bits) + 0.5) / 9007199254740992.0; // 2^53
+}
+
+template <class T, class Rng>
+void ReservoirSampler<T, Rng>::drawNext()
+{
+    // The number of cards skipped is geometric, with success probability mWeight
+    const double skip = std::floor(std::log(uniform()) / std::log1p(-mWeight));
+    const double limit = static_cast<double>(std::numeric_limits<std::uint64_t>::max() / 2);
+    mNext = skip < limit - static_cast<double>(mSeen) ? mSeen + 1 + static_cast<std::uint64_t>(skip) :
+        std::numeric_limits<std::uint64_t>::max();
+}
+
+} // namespace doc
+#endif
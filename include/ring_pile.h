@@ -0,0 +1,370 @@
+/**
+ * @file ring_pile.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare RingPile class, a fixed-capacity pile of cards stored in a circular buffer.
+ */
+
+#ifndef RING_PILE_H
+#define RING_PILE_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class RingPile "ring_pile.h" "ring_pile.h"
+ *
+ * @brief A pile of data with a fixed capacity, stored in a circular buffer. The "back" of the pile is the top,
+ * and the "front" of the pile is the bottom, the same as a Deck.
+ *
+ * Adding to or removing from either the top or the bottom is O(1), and never allocates. Memory is only
+ * allocated when the pile is constructed, or when reserve() or assign() need a larger capacity, so a game
+ * can size its piles once during setup and then play without allocating.
+ *
+ * RingPile provides the members Deck uses from its storage, so it can be used as a Deck backend, given after the
+ * random number generator: Deck<T, std::mt19937, RingPile<T>>.
+ *
+ * T must meet the requirements of DefaultConstructible and MoveAssignable. Items are constructed in place by
+ * move-assigning them into a default constructed slot of the buffer.
+ *
+ * The buffer is allocated with Allocator, which is std::allocator by default. pmr::RingPile allocates from a
+ * std::pmr::memory_resource, such as an arena shared by many piles.
+ */
+template <class T, class Allocator = std::allocator<T>>
+class RingPile
+{
+    public:
+
+        /**
+         * @brief Iterator over a RingPile, from bottom to top
+         */
+        template <class Pile, class Value>
+        class Iterator
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Value*;
+                using reference = Value&;
+
+                Iterator(Pile* pile, std::size_t index) : mPile(pile), mIndex(index) {}
+                reference operator*() const { return (*mPile)[mIndex]; }
+                pointer operator->() const { return &(*mPile)[mIndex]; }
+                Iterator& operator++() { mIndex++; return *this; }
+                Iterator operator++(int) { Iterator previous = *this; mIndex++; return previous; }
+                bool operator==(const Iterator& other) const { return mIndex == other.mIndex; }
+                bool operator!=(const Iterator& other) const { return mIndex != other.mIndex; }
+
+            private:
+                Pile* mPile; /**<@brief Pile iterated over */
+                std::size_t mIndex; /**<@brief Position within the pile, 0 is the bottom */
+        };
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using allocator_type = Allocator;
+        using iterator = Iterator<RingPile, T>;
+        using const_iterator = Iterator<const RingPile, const T>;
+
+        /**
+         * @brief Construct empty pile with no capacity
+         */
+        RingPile() = default;
+
+        /**
+         * @brief Construct empty pile with no capacity, that allocates with allocator
+         */
+        explicit RingPile(const Allocator& allocator) : mBuffer(allocator) {}
+
+        /**
+         * @brief Construct empty pile
+         * @param[in] capacity Maximum number of items the pile can hold
+         * @param[in] allocator Allocator for the pile's buffer
+         */
+        explicit RingPile(std::size_t capacity, const Allocator& allocator = Allocator()) :
+            mBuffer(capacity, allocator) {}
+
+        /**
+         * @brief Construct pile holding data, with capacity for exactly that data
+         * @param[in] data Data to hold. The back of data is the top of the pile.
+         * @param[in] allocator Allocator for the pile's buffer
+         */
+        RingPile(const std::vector<T>& data, const Allocator& allocator = Allocator()) :
+            mBuffer(data.begin(), data.end(), allocator), mCount(data.size()) {}
+
+        /**
+         * @brief Construct pile holding data moved from a vector, with capacity for exactly that data
+         * @param[in] data Data to hold. With the default allocator the pile takes over its storage, otherwise
+         * the items are moved into a buffer from allocator. The back of data is the top.
+         * @param[in] allocator Allocator for the pile's buffer
+         */
+        RingPile(std::vector<T>&& data, const Allocator& allocator = Allocator()) :
+            mBuffer(makeBuffer(std::move(data), allocator)), mCount(mBuffer.size()) {}
+
+        /**
+         * @brief Returns the allocator of the pile's buffer
+         */
+        Allocator get_allocator() const { return mBuffer.get_allocator(); }
+
+        /**
+         * @brief Returns if the pile is empty
+         * @return True if the pile is empty, false otherwise
+         */
+        bool empty() const { return mCount == 0; }
+
+        /**
+         * @brief Returns the number of items in the pile
+         * @return Size of the pile
+         */
+        std::size_t size() const { return mCount; }
+
+        /**
+         * @brief Returns the maximum number of items the pile can hold
+         * @return Capacity of the pile
+         */
+        std::size_t capacity() const { return mBuffer.size(); }
+
+        /**
+         * @brief Increase the capacity of the pile, keeping its contents. Does nothing if the pile already has
+         * at least this capacity.
+         * @param[in] capacity Minimum capacity of the pile
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * @brief Replace the contents of the pile, increasing its capacity if needed
+         * @param[in] first Start of the data, which becomes the bottom of the pile
+         * @param[in] last End of the data
+         */
+        template <class InputIt>
+        void assign(InputIt first, InputIt last);
+
+        /**
+         * @brief Remove every item from the pile, keeping its capacity
+         */
+        void clear() { mHead = 0; mCount = 0; }
+
+        /**
+         * @brief Returns the item at a position in the pile. Position 0 is the bottom, and size() - 1 is the top.
+         * @param[in] index Position in the pile, must be less than size()
+         * @return Item at that position
+         */
+        T& operator[](std::size_t index) { return mBuffer[physical(index)]; }
+        const T& operator[](std::size_t index) const { return mBuffer[physical(index)]; }
+
+        /** @brief Returns the item on top of the pile. The pile must not be empty. */
+        T& back() { return (*this)[mCount - 1]; }
+        const T& back() const { return (*this)[mCount - 1]; }
+
+        /** @brief Returns the item on the bottom of the pile. The pile must not be empty. */
+        T& front() { return mBuffer[mHead]; }
+        const T& front() const { return mBuffer[mHead]; }
+
+        /**
+         * @brief Add an item to the top of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] value Item to add
+         */
+        void push_back(const T& value);
+        void push_back(T&& value);
+
+        /**
+         * @brief Add an item to the bottom of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] value Item to add
+         */
+        void push_front(const T& value);
+        void push_front(T&& value);
+
+        /**
+         * @brief Construct an item on top of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] args Arguments to construct the item with
+         * @return The new item
+         */
+        template <class... Args>
+        T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Construct an item at the bottom of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] args Arguments to construct the item with
+         * @return The new item
+         */
+        template <class... Args>
+        T& emplace_front(Args&&... args);
+
+        /** @brief Remove the item on top of the pile. The pile must not be empty. */
+        void pop_back() { mCount--; }
+
+        /** @brief Remove the item on the bottom of the pile. The pile must not be empty. */
+        void pop_front() { mHead = physical(1); mCount--; }
+
+        /**
+         * @brief Exchange the contents and capacity of two piles, without copying or allocating. The piles'
+         * allocators must compare equal, as for std::vector::swap().
+         * @param[in] other Pile to exchange with
+         */
+        void swap(RingPile& other) noexcept;
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, mCount); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, mCount); }
+
+    private:
+
+        using Buffer = std::vector<T, Allocator>;
+
+        /**
+         * @brief Returns a buffer holding data, taking over its storage when the allocators match
+         */
+        static Buffer makeBuffer(std::vector<T>&& data, const Allocator& allocator)
+        {
+            if constexpr (std::is_same<Buffer, std::vector<T>>::value)
+                return Buffer(std::move(data), allocator);
+            else
+                return Buffer(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()), allocator);
+        }
+
+        /**
+         * @brief Returns the position in the buffer of a position in the pile
+         */
+        std::size_t physical(std::size_t index) const
+        {
+            const std::size_t position = mHead + index;
+            return position < mBuffer.size() ? position : position - mBuffer.size();
+        }
+
+        Buffer mBuffer; /**<@brief Circular buffer, its size is the pile's capacity */
+        std::size_t mHead = 0; /**<@brief Position in the buffer of the bottom of the pile */
+        std::size_t mCount = 0; /**<@brief Number of items in the pile */
+
+};
+
+/**
+ * @brief Exchange the contents of two piles
+ */
+template <class T, class Allocator>
+void swap(RingPile<T, Allocator>& first, RingPile<T, Allocator>& second) noexcept
+{
+    first.swap(second);
+}
+
+/**
+ * @brief Aliases of the library's containers that allocate from a std::pmr::memory_resource
+ */
+namespace pmr
+{
+
+template <class T>
+using RingPile = doc::RingPile<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+// Definition below
+template <class T, class Allocator>
+void RingPile<T, Allocator>::reserve(std::size_t capacity)
+{
+    if (capacity <= mBuffer.size())
+        return;
+
+    Buffer buffer(capacity, mBuffer.get_allocator());
+    for (std::size_t i = 0; i < mCount; i++)
+        buffer[i] = std::move((*this)[i]);
+    mBuffer.swap(buffer);
+    mHead = 0;
+}
+
+template <class T, class Allocator>
+template <class InputIt>
+void RingPile<T, Allocator>::assign(InputIt first, InputIt last)
+{
+    clear();
+    for (; first != last; ++first)
+    {
+        if (mCount == mBuffer.size())
+            reserve(mBuffer.empty() ? 1 : mBuffer.size() * 2);
+        mBuffer[mCount++] = *first;
+    }
+}
+
+template <class T, class Allocator>
+void RingPile<T, Allocator>::push_back(const T& value)
+{
+    emplace_back(value);
+}
+
+template <class T, class Allocator>
+void RingPile<T, Allocator>::push_back(T&& value)
+{
+    emplace_back(std::move(value));
+}
+
+template <class T, class Allocator>
+void RingPile<T, Allocator>::push_front(const T& value)
+{
+    emplace_front(value);
+}
+
+template <class T, class Allocator>
+void RingPile<T, Allocator>::push_front(T&& value)
+{
+    emplace_front(std::move(value));
+}
+
+template <class T, class Allocator>
+template <class... Args>
+T& RingPile<T, Allocator>::emplace_back(Args&&... args)
+{
+    if (mCount == mBuffer.size())
+        throw std::length_error("RingPile is full");
+    T& slot = mBuffer[physical(mCount)];
+    slot = T(std::forward<Args>(args)...);
+    mCount++;
+    return slot;
+}
+
+template <class T, class Allocator>
+template <class... Args>
+T& RingPile<T, Allocator>::emplace_front(Args&&... args)
+{
+    if (mCount == mBuffer.size())
+        throw std::length_error("RingPile is full");
+    const std::size_t head = mHead == 0 ? mBuffer.size() - 1 : mHead - 1;
+    mBuffer[head] = T(std::forward<Args>(args)...);
+    mHead = head;
+    mCount++;
+    return mBuffer[head];
+}
+
+template <class T, class Allocator>
+void RingPile<T, Allocator>::swap(RingPile& other) noexcept
+{
+    mBuffer.swap(other.mBuffer);
+    std::swap(mHead, other.mHead);
+    std::swap(mCount, other.mCount);
+}
+
+} // namespace doc
+#endif
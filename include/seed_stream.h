@@ -0,0 +1,206 @@
+/**
+ * @file seed_stream.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare SeedStream class, that expands one master seed into the seeds of threads, games and decks, and
+ * the per-thread streams that seed decks constructed without a seed.
+ */
+
+#ifndef SEED_STREAM_H
+#define SEED_STREAM_H
+
+#include "random_engines.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class SeedStream "seed_stream.h" "seed_stream.h"
+ * @brief A deterministic stream of 64-bit seeds, expanded from one seed with SplitMix64.
+ *
+ * Streams form a hierarchy: a master stream gives each thread or game its own stream with child(index), in
+ * O(1) and without advancing, and a game's stream gives each of its decks a stream with split(). Anything
+ * seeded this way can be regenerated from the master seed and the indexes that lead to it. WarSimulator seeds
+ * game i of a batch with SeedStream(masterSeed).at(i), and a seeded WarCardGame seeds its decks with the
+ * values of SeedStream(seed) in turn.
+ *
+ * seed(engine) seeds a random number generator from the stream. Engines that accept a seed sequence, such as
+ * std::mt19937, have their whole state filled from the stream, rather than from one 32-bit value; the engines
+ * in random_engines.h take the next 64-bit value, which they expand themselves.
+ *
+ * SeedStream also meets the requirements of a SeedSequence's generate(), for use with std engines directly.
+ */
+class SeedStream
+{
+    public:
+        using result_type = std::uint32_t;
+
+        /**
+         * @brief Construct stream from a seed
+         * @param[in] seed Seed, any value is valid
+         */
+        explicit SeedStream(std::uint64_t seed = 0) : mSequence(seed) {}
+
+        /**
+         * @brief Returns the next seed of the stream
+         */
+        std::uint64_t next() { return mSequence(); }
+
+        /**
+         * @brief Returns a seed of the stream by its index, without advancing. at(0) is the value next() would
+         * return now.
+         * @param[in] index Index of the seed, counted from the stream's current position
+         */
+        std::uint64_t at(std::uint64_t index) const
+        {
+            SplitMix64 sequence = mSequence;
+            sequence.discard(index);
+            return sequence();
+        }
+
+        /**
+         * @brief Returns the stream seeded by at(index), such as the stream of a thread or game by its number
+         * @param[in] index Index of the child stream
+         */
+        SeedStream child(std::uint64_t index) const { return SeedStream(at(index)); }
+
+        /**
+         * @brief Returns a new stream seeded by next(), such as the stream of the next deck
+         */
+        SeedStream split() { return SeedStream(next()); }
+
+        /**
+         * @brief Seeds a random number generator from the stream, filling its whole state if it accepts a seed
+         * sequence, and with next() otherwise
+         * @param[in] engine Random number generator to seed
+         */
+        template <class Rng>
+        void seed(Rng& engine);
+
+        /**
+         * @brief Fills a range with 32-bit values from the stream, as SeedSequence::generate() does
+         */
+        template <class RandomIt>
+        void generate(RandomIt first, RandomIt last)
+        {
+            for (; first != last; ++first)
+                *first = static_cast<result_type>(next() >> 32);
+        }
+
+        bool operator==(const SeedStream& other) const { return mSequence == other.mSequence; }
+        bool operator!=(const SeedStream& other) const { return mSequence != other.mSequence; }
+
+    private:
+        SplitMix64 mSequence; /**<@brief Generates the stream's seeds */
+};
+
+namespace detail
+{
+
+/**
+ * @brief True if Rng can be seeded with a seed sequence, rather than a single value
+ */
+template <class Rng, class = void>
+struct SeedsFromSequence : std::false_type {};
+
+template <class Rng>
+struct SeedsFromSequence<Rng, std::void_t<decltype(std::declval<Rng&>().seed(std::declval<SeedStream&>()))>> :
+    std::true_type {};
+
+} // namespace detail
+
+template <class Rng>
+void SeedStream::seed(Rng& engine)
+{
+    if constexpr (detail::SeedsFromSequence<Rng>::value)
+        engine.seed(*this);
+    else
+        engine.seed(next());
+}
+
+/**
+ * @brief Seeds for objects constructed without one.
+ *
+ * The process seed is read from std::random_device once per process, unless set first with setProcessSeed().
+ * Each thread's stream is the process stream's child, by the order threads first ask for one, so constructing
+ * any number of unseeded decks costs no system calls, and a single threaded program that sets the process
+ * seed constructs the same decks every run.
+ */
+namespace seeding
+{
+
+namespace detail
+{
+
+/**
+ * @brief The process seed, and if it has been set or read
+ */
+struct ProcessSeed
+{
+    std::mutex mutex; /**<@brief Guards the members below */
+    bool set = false; /**<@brief If seed has been set or read from std::random_device */
+    std::uint64_t seed = 0; /**<@brief Process seed */
+};
+
+inline ProcessSeed& processSeedState()
+{
+    static ProcessSeed state;
+    return state;
+}
+
+} // namespace detail
+
+/**
+ * @brief Sets the process seed. Only streams of threads that have not yet asked for one are affected.
+ * @param[in] seed Process seed
+ */
+inline void setProcessSeed(std::uint64_t seed)
+{
+    detail::ProcessSeed& state = detail::processSeedState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.seed = seed;
+    state.set = true;
+}
+
+/**
+ * @brief Returns the process seed, reading it from std::random_device the first time if it was not set
+ */
+inline std::uint64_t processSeed()
+{
+    detail::ProcessSeed& state = detail::processSeedState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.set)
+    {
+        std::random_device randomSeeder;
+        state.seed = (static_cast<std::uint64_t>(randomSeeder()) << 32) | randomSeeder();
+        state.set = true;
+    }
+    return state.seed;
+}
+
+/**
+ * @brief Returns this thread's stream, which seeds the decks it constructs without a seed
+ */
+inline SeedStream& threadStream()
+{
+    static std::atomic<std::uint64_t> threads(0);
+    static thread_local SeedStream stream = SeedStream(processSeed()).child(threads.fetch_add(1));
+    return stream;
+}
+
+} // namespace seeding
+
+} // namespace doc
+#endif
@@ -0,0 +1,320 @@
+/**
+ * @file shoe.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare Shoe class, that deals from several decks at once, like a casino dealing shoe.
+ */
+
+#ifndef SHOE_H
+#define SHOE_H
+
+#include "bounded_random.h"
+#include "deck.h"
+#include "seed_stream.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @brief How a Shoe returns dealt cards
+ */
+enum class ShoeMode
+{
+    CutCard, /**<@brief Dealt cards are discarded until the cut card is reached, then the shoe is shuffled */
+    ContinuousShuffle /**<@brief Dealt cards go back into the shoe after every hand, like a shuffling machine */
+};
+
+/**
+ * @class Shoe "shoe.h" "shoe.h"
+ *
+ * @brief A shoe of several copies of a deck, dealt in a random order.
+ *
+ * The deck is stored once, and the shoe only counts the copies left of each of its cards, so a shoe of 8
+ * decks holds one copy of each card and one count per card, rather than 8 copies or 8 positions. The shoe is
+ * shuffled lazily: each deal_card() picks a random card from those left, each card weighted by its copies
+ * left, so the shoe never has an order. The counts are kept in a Fenwick tree, so dealing costs O(log d) per
+ * card for a deck of d cards, whatever the number of decks.
+ *
+ * In ShoeMode::CutCard a cut card is placed at a penetration of the shoe, e.g. 0.75 of the cards. Once it is
+ * reached, endHand() shuffles every card back into the shoe, rebuilding the counts in O(d). In
+ * ShoeMode::ContinuousShuffle the shoe remembers the positions dealt since the last hand, and endHand() puts
+ * each back in O(log d), so a hand of k cards costs O(k log d) to return, whatever the size of the shoe.
+ *
+ * A shoe constructed without a seed is seeded from its thread's SeedStream (see seeding::threadStream()). Pass
+ * a SeedStream to seed a shoe reproducibly.
+ *
+ * T must meet the requirements of CopyConstructible, as each card dealt is a copy of a card in the deck.
+ */
+template <class T, class Rng = std::mt19937>
+class Shoe
+{
+    public:
+
+        /**
+         * @brief Construct a full shoe
+         *
+         * Initializes internal random number generator.
+         * Throws std::invalid_argument if deck or numDecks is empty, or penetration is not in (0, 1]
+         * @param[in] deck One deck, which the shoe holds numDecks copies of
+         * @param[in] numDecks Number of decks in the shoe
+         * @param[in] mode How dealt cards are returned to the shoe
+         * @param[in] penetration Fraction of the shoe dealt before the cut card is reached, in ShoeMode::CutCard
+         */
+        Shoe(const std::vector<T>& deck, std::size_t numDecks, ShoeMode mode = ShoeMode::CutCard,
+                double penetration = 0.75);
+
+        /**
+         * @brief Construct a full shoe, with a stream to seed its random number generator from
+         *
+         * Throws std::invalid_argument as above
+         * @param[in] deck One deck, which the shoe holds numDecks copies of
+         * @param[in] numDecks Number of decks in the shoe
+         * @param[in] stream Stream of seeds (see seed(SeedStream))
+         * @param[in] mode How dealt cards are returned to the shoe
+         * @param[in] penetration Fraction of the shoe dealt before the cut card is reached, in ShoeMode::CutCard
+         */
+        Shoe(const std::vector<T>& deck, std::size_t numDecks, SeedStream stream, ShoeMode mode = ShoeMode::CutCard,
+                double penetration = 0.75);
+
+        /**
+         * @brief No copy constructor to prevent multiple shoes using the same seeded random number generator
+         */
+        Shoe(const Shoe&) = delete;
+
+        /**
+         * @brief No Copy assignment operator to prevent multiple shoes using the same seeded random generator
+         */
+        Shoe& operator=(const Shoe&) = delete;
+
+        /**
+         * @brief Re-seed the internal random number generator.
+         * @param[in] value Seed for the random number generator
+         */
+        void seed(typename Rng::result_type value);
+
+        /**
+         * @brief Re-seed the internal random number generator from a seed stream, filling its whole state if it
+         * accepts a seed sequence (see SeedStream::seed()).
+         * @param[in] stream Stream of seeds
+         */
+        void seed(SeedStream stream);
+
+        /**
+         * @brief Returns every dealt card to the shoe and shuffles it, in O(d) for a deck of d cards
+         */
+        void shuffle();
+
+        /**
+         * @brief Returns if every card in the shoe has been dealt
+         */
+        bool empty() const { return mRemaining == 0; }
+
+        /**
+         * @brief Returns the number of cards left to deal
+         */
+        std::size_t size() const { return mRemaining; }
+
+        /**
+         * @brief Returns the number of cards in a full shoe
+         */
+        std::size_t capacity() const { return mCapacity; }
+
+        /**
+         * @brief Returns the number of decks in the shoe
+         */
+        std::size_t numDecks() const { return mNumDecks; }
+
+        /**
+         * @brief Returns how dealt cards are returned to the shoe
+         */
+        ShoeMode mode() const { return mMode; }
+
+        /**
+         * @brief Returns a random card from those left in the shoe, removing it from the shoe
+         *
+         * Calling this method on an empty shoe will throw an EmptyDeckException
+         * @return Card dealt
+         */
+        T deal_card();
+
+        /**
+         * @brief Returns if the cut card has been reached, so the shoe will be shuffled at the end of the hand.
+         * Always false in ShoeMode::ContinuousShuffle.
+         */
+        bool cutCardReached() const;
+
+        /**
+         * @brief Ends a hand, once its cards have been discarded.
+         *
+         * In ShoeMode::CutCard the shoe is shuffled if the cut card has been reached. In
+         * ShoeMode::ContinuousShuffle every card dealt since the last hand goes back into the shoe.
+         * @return True if dealt cards were returned to the shoe
+         */
+        bool endHand();
+
+    private:
+
+        /**
+         * @brief Returns the deck position of the card with the given index, counting the copies left of each
+         * card in deck order
+         */
+        std::size_t findCard(std::uint64_t index) const;
+
+        std::vector<T> mDeck; /**<@brief The one deck the shoe holds copies of */
+        std::vector<std::size_t> mCounts; /**<@brief Fenwick tree of the copies left of each deck position,
+                                               indexed from 1 */
+        std::vector<std::size_t> mHand; /**<@brief Deck positions dealt since the last hand, in
+                                             ShoeMode::ContinuousShuffle */
+        std::size_t mNumDecks; /**<@brief Number of decks in the shoe */
+        std::size_t mCapacity; /**<@brief Number of cards in a full shoe */
+        std::size_t mTopBit; /**<@brief Largest power of 2 no greater than the deck size, to search mCounts */
+        std::size_t mRemaining; /**<@brief Number of cards left to deal */
+        std::size_t mCutCard; /**<@brief Number of cards dealt when the cut card is reached */
+        ShoeMode mMode; /**<@brief How dealt cards are returned to the shoe */
+        Rng mRandomGen; /**<@brief Use for shuffling */
+        BoundedRandom<Rng> mRandom; /**<@brief Draws from mRandomGen */
+
+};
+
+// Definition below
+template<class T, class Rng>
+Shoe<T, Rng>::Shoe(const std::vector<T>& deck, std::size_t numDecks, ShoeMode mode, double penetration) :
+    Shoe(deck, numDecks, seeding::threadStream().split(), mode, penetration)
+{
+}
+
+template<class T, class Rng>
+Shoe<T, Rng>::Shoe(const std::vector<T>& deck, std::size_t numDecks, SeedStream stream, ShoeMode mode,
+        double penetration) :
+    mDeck(deck),
+    mNumDecks(numDecks),
+    mCapacity(deck.size() * numDecks),
+    mTopBit(1),
+    mRemaining(0),
+    mCutCard(0),
+    mMode(mode),
+    mRandom(mRandomGen)
+{
+    if (deck.empty() || numDecks == 0)
+        throw std::invalid_argument("Shoe needs at least one card");
+    if (!(penetration > 0.0 && penetration <= 1.0))
+        throw std::invalid_argument("Shoe penetration must be in (0, 1]");
+    if (numDecks > std::numeric_limits<std::size_t>::max() / deck.size())
+        throw std::invalid_argument("Shoe is too large");
+
+    while (mTopBit * 2 <= deck.size())
+        mTopBit *= 2;
+    shuffle();
+    mCutCard = std::max<std::size_t>(1, static_cast<std::size_t>(std::llround(penetration * mCapacity)));
+
+    stream.seed(mRandomGen);
+}
+
+template<class T, class Rng>
+void Shoe<T, Rng>::seed(typename Rng::result_type value)
+{
+    mRandomGen.seed(value);
+    mRandom.reset();
+}
+
+template<class T, class Rng>
+void Shoe<T, Rng>::seed(SeedStream stream)
+{
+    stream.seed(mRandomGen);
+    mRandom.reset();
+}
+
+template<class T, class Rng>
+void Shoe<T, Rng>::shuffle()
+{
+    // Each deal picks uniformly from the cards left, so they need no particular order. Every position holds
+    // numDecks copies again, and the tree is built in O(d) by adding each node to its parent.
+    mCounts.assign(mDeck.size() + 1, mNumDecks);
+    mCounts[0] = 0;
+    for (std::size_t node = 1; node <= mDeck.size(); node++)
+    {
+        const std::size_t parent = node + (node & (0 - node));
+        if (parent <= mDeck.size())
+            mCounts[parent] += mCounts[node];
+    }
+    mRemaining = mCapacity;
+    mHand.clear();
+}
+
+template<class T, class Rng>
+T Shoe<T, Rng>::deal_card()
+{
+    if (mRemaining == 0)
+        throw EmptyDeckException();
+
+    // Choose one of the cards left uniformly, and take one copy of it from the counts
+    const std::size_t position = findCard(mRandom.below(std::uint64_t(mRemaining)));
+    for (std::size_t node = position + 1; node <= mDeck.size(); node += node & (0 - node))
+        mCounts[node]--;
+    mRemaining--;
+    if (mMode == ShoeMode::ContinuousShuffle)
+        mHand.push_back(position);
+    return mDeck[position];
+}
+
+template<class T, class Rng>
+std::size_t Shoe<T, Rng>::findCard(std::uint64_t index) const
+{
+    // Descend the tree, skipping each subtree whose cards all come before index
+    std::size_t position = 0;
+    for (std::size_t step = mTopBit; step > 0; step /= 2)
+    {
+        if (position + step <= mDeck.size() && mCounts[position + step] <= index)
+        {
+            position += step;
+            index -= mCounts[position];
+        }
+    }
+    return position;
+}
+
+template<class T, class Rng>
+bool Shoe<T, Rng>::cutCardReached() const
+{
+    return mMode == ShoeMode::CutCard && mCapacity - mRemaining >= mCutCard;
+}
+
+template<class T, class Rng>
+bool Shoe<T, Rng>::endHand()
+{
+    if (mMode == ShoeMode::ContinuousShuffle)
+    {
+        // Put back one copy of each card dealt, as deal_card() took it. mHand keeps its capacity between hands.
+        for (const std::size_t position : mHand)
+        {
+            for (std::size_t node = position + 1; node <= mDeck.size(); node += node & (0 - node))
+                mCounts[node]++;
+        }
+        mRemaining += mHand.size();
+        const bool returned = !mHand.empty();
+        mHand.clear();
+        return returned;
+    }
+    if (cutCardReached())
+    {
+        shuffle();
+        return true;
+    }
+    return false;
+}
+
+} // namespace doc
+#endif
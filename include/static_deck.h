@@ -0,0 +1,304 @@
+/**
+ * @file static_deck.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare StaticPile class, a pile of cards stored inline in a fixed-size array, and StaticDeck, a Deck
+ * stored in one.
+ */
+
+#ifndef STATIC_DECK_H
+#define STATIC_DECK_H
+
+#include "deck.h"
+#include "random_engines.h"
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class StaticPile "static_deck.h" "static_deck.h"
+ *
+ * @brief A pile of at most N items, stored in a circular buffer inside the pile itself. The "back" of the pile
+ * is the top, and the "front" of the pile is the bottom, the same as a Deck.
+ *
+ * StaticPile has the same interface as RingPile, but never allocates: its buffer is a std::array member, so a
+ * pile, and a game made of them, can sit on the stack or in a contiguous array of games. Adding to or removing
+ * from either the top or the bottom is O(1). Exchanging two piles with swap() copies their buffers, which for a
+ * deck of CompactCard is a few dozen bytes. Everything but swap() is constexpr, so a pile can be built at
+ * compile time, e.g. from buildStandardDeckArray<CompactCard>().
+ *
+ * StaticPile provides the members Deck uses from its storage, so it can be used as a Deck backend: see
+ * StaticDeck.
+ *
+ * T must meet the requirements of DefaultConstructible and MoveAssignable, as with RingPile. CompactCard does,
+ * and is the card to use with StaticPile.
+ */
+template <class T, std::size_t N>
+class StaticPile
+{
+    public:
+
+        /**
+         * @brief Iterator over a StaticPile, from bottom to top
+         */
+        template <class Pile, class Value>
+        class Iterator
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Value*;
+                using reference = Value&;
+
+                constexpr Iterator(Pile* pile, std::size_t index) : mPile(pile), mIndex(index) {}
+                constexpr reference operator*() const { return (*mPile)[mIndex]; }
+                constexpr pointer operator->() const { return &(*mPile)[mIndex]; }
+                constexpr Iterator& operator++() { mIndex++; return *this; }
+                constexpr Iterator operator++(int) { Iterator previous = *this; mIndex++; return previous; }
+                constexpr bool operator==(const Iterator& other) const { return mIndex == other.mIndex; }
+                constexpr bool operator!=(const Iterator& other) const { return mIndex != other.mIndex; }
+
+            private:
+                Pile* mPile; /**<@brief Pile iterated over */
+                std::size_t mIndex; /**<@brief Position within the pile, 0 is the bottom */
+        };
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using iterator = Iterator<StaticPile, T>;
+        using const_iterator = Iterator<const StaticPile, const T>;
+
+        /**
+         * @brief Construct empty pile
+         */
+        constexpr StaticPile() : mBuffer() {}
+
+        /**
+         * @brief Construct pile holding data
+         *
+         * Throws std::length_error if there are more than N items
+         * @param[in] data Data to hold. The back of data is the top of the pile.
+         */
+        StaticPile(const std::vector<T>& data) : StaticPile() { assign(data.begin(), data.end()); }
+
+        /**
+         * @brief Construct pile holding every item of an array, converted to T, at compile time if the array is
+         * constexpr
+         * @param[in] data Data to hold, with at most N items. The back of data is the top of the pile.
+         */
+        template <class U, std::size_t M>
+        constexpr explicit StaticPile(const std::array<U, M>& data) : mBuffer(), mCount(M)
+        {
+            static_assert(M <= N, "StaticPile: too many items for its capacity");
+            for (std::size_t i = 0; i < M; i++)
+                mBuffer[i] = T(data[i]);
+        }
+
+        /**
+         * @brief Returns if the pile is empty
+         * @return True if the pile is empty, false otherwise
+         */
+        constexpr bool empty() const { return mCount == 0; }
+
+        /**
+         * @brief Returns the number of items in the pile
+         * @return Size of the pile
+         */
+        constexpr std::size_t size() const { return mCount; }
+
+        /**
+         * @brief Returns the maximum number of items the pile can hold, N
+         * @return Capacity of the pile
+         */
+        static constexpr std::size_t capacity() { return N; }
+
+        /**
+         * @brief Checks the pile can hold a number of items. The capacity is fixed, so nothing is allocated.
+         *
+         * Throws std::length_error if capacity is more than N
+         * @param[in] capacity Number of items the pile must be able to hold
+         */
+        constexpr void reserve(std::size_t capacity) const
+        {
+            if (capacity > N)
+                throw std::length_error("StaticPile capacity exceeded");
+        }
+
+        /**
+         * @brief Replace the contents of the pile
+         *
+         * Throws std::length_error if there are more than N items
+         * @param[in] first Start of the data, which becomes the bottom of the pile
+         * @param[in] last End of the data
+         */
+        template <class InputIt>
+        constexpr void assign(InputIt first, InputIt last);
+
+        /**
+         * @brief Remove every item from the pile
+         */
+        constexpr void clear() { mHead = 0; mCount = 0; }
+
+        /**
+         * @brief Returns the item at a position in the pile. Position 0 is the bottom, and size() - 1 is the top.
+         * @param[in] index Position in the pile, must be less than size()
+         * @return Item at that position
+         */
+        constexpr T& operator[](std::size_t index) { return mBuffer[physical(index)]; }
+        constexpr const T& operator[](std::size_t index) const { return mBuffer[physical(index)]; }
+
+        /** @brief Returns the item on top of the pile. The pile must not be empty. */
+        constexpr T& back() { return (*this)[mCount - 1]; }
+        constexpr const T& back() const { return (*this)[mCount - 1]; }
+
+        /** @brief Returns the item on the bottom of the pile. The pile must not be empty. */
+        constexpr T& front() { return mBuffer[mHead]; }
+        constexpr const T& front() const { return mBuffer[mHead]; }
+
+        /**
+         * @brief Add an item to the top of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] value Item to add
+         */
+        constexpr void push_back(const T& value) { emplace_back(value); }
+        constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        /**
+         * @brief Add an item to the bottom of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] value Item to add
+         */
+        constexpr void push_front(const T& value) { emplace_front(value); }
+        constexpr void push_front(T&& value) { emplace_front(std::move(value)); }
+
+        /**
+         * @brief Construct an item on top of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] args Arguments to construct the item with
+         * @return The new item
+         */
+        template <class... Args>
+        constexpr T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Construct an item at the bottom of the pile
+         *
+         * Throws std::length_error if the pile is full
+         * @param[in] args Arguments to construct the item with
+         * @return The new item
+         */
+        template <class... Args>
+        constexpr T& emplace_front(Args&&... args);
+
+        /** @brief Remove the item on top of the pile. The pile must not be empty. */
+        constexpr void pop_back() { mCount--; }
+
+        /** @brief Remove the item on the bottom of the pile. The pile must not be empty. */
+        constexpr void pop_front() { mHead = physical(1); mCount--; }
+
+        /**
+         * @brief Exchange the contents of two piles. Copies both buffers, but does not allocate.
+         * @param[in] other Pile to exchange with
+         */
+        void swap(StaticPile& other) noexcept
+        {
+            mBuffer.swap(other.mBuffer);
+            std::swap(mHead, other.mHead);
+            std::swap(mCount, other.mCount);
+        }
+
+        constexpr iterator begin() { return iterator(this, 0); }
+        constexpr iterator end() { return iterator(this, mCount); }
+        constexpr const_iterator begin() const { return const_iterator(this, 0); }
+        constexpr const_iterator end() const { return const_iterator(this, mCount); }
+
+    private:
+
+        /**
+         * @brief Returns the position in the buffer of a position in the pile
+         */
+        constexpr std::size_t physical(std::size_t index) const
+        {
+            const std::size_t position = mHead + index;
+            return position < N ? position : position - N;
+        }
+
+        std::array<T, N> mBuffer; /**<@brief Circular buffer */
+        std::size_t mHead = 0; /**<@brief Position in the buffer of the bottom of the pile */
+        std::size_t mCount = 0; /**<@brief Number of items in the pile */
+
+};
+
+/**
+ * @brief Exchange the contents of two piles
+ */
+template <class T, std::size_t N>
+void swap(StaticPile<T, N>& first, StaticPile<T, N>& second) noexcept
+{
+    first.swap(second);
+}
+
+/**
+ * @brief Deck of at most N cards that never allocates, with the same interface as Deck.
+ *
+ * The deck's cards and random number generator are stored inline, with the 32 byte Xoshiro256StarStar as the
+ * default generator in place of Deck's std::mt19937. Construct it from an array, such as the constexpr
+ * buildStandardDeckArray<CompactCard>(), to fill it without a std::vector. contents() and take() still return
+ * a std::vector, and so allocate.
+ */
+template <class T, std::size_t N, class Rng = Xoshiro256StarStar>
+using StaticDeck = Deck<T, Rng, StaticPile<T, N>>;
+
+// Definition below
+template <class T, std::size_t N>
+template <class InputIt>
+constexpr void StaticPile<T, N>::assign(InputIt first, InputIt last)
+{
+    clear();
+    for (; first != last; ++first)
+        emplace_back(*first);
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr T& StaticPile<T, N>::emplace_back(Args&&... args)
+{
+    if (mCount == N)
+        throw std::length_error("StaticPile is full");
+    T& slot = mBuffer[physical(mCount)];
+    slot = T(std::forward<Args>(args)...);
+    mCount++;
+    return slot;
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+constexpr T& StaticPile<T, N>::emplace_front(Args&&... args)
+{
+    if (mCount == N)
+        throw std::length_error("StaticPile is full");
+    const std::size_t head = mHead == 0 ? N - 1 : mHead - 1;
+    mBuffer[head] = T(std::forward<Args>(args)...);
+    mHead = head;
+    mCount++;
+    return mBuffer[head];
+}
+
+} // namespace doc
+#endif
@@ -0,0 +1,219 @@
+/**
+ * @file statistics.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare streaming statistics accumulators, that summarize any number of values in fixed memory and
+ * can be merged.
+ */
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class RunningStats "statistics.h" "statistics.h"
+ * @brief Count, mean, variance, minimum and maximum of a stream of values, updated with Welford's algorithm.
+ *
+ * Two accumulators merge with Chan's parallel update, so values can be added on separate threads and merged
+ * at the end. Merging gives the same count, minimum and maximum as adding every value to one accumulator,
+ * and the same mean and variance up to rounding.
+ */
+class RunningStats
+{
+    public:
+
+        /**
+         * @brief Add a value
+         */
+        void add(double value);
+
+        /**
+         * @brief Add every value added to another accumulator
+         */
+        void merge(const RunningStats& other);
+
+        /** @brief Returns the number of values added */
+        unsigned long long count() const { return mCount; }
+
+        /** @brief Returns the mean of the values, or 0 if there are none */
+        double mean() const { return mMean; }
+
+        /** @brief Returns the sample variance of the values, or 0 if there are fewer than two */
+        double variance() const;
+
+        /** @brief Returns the sample standard deviation of the values, or 0 if there are fewer than two */
+        double stddev() const;
+
+        /** @brief Returns the smallest value, or 0 if there are none */
+        double min() const { return mCount == 0 ? 0.0 : mMin; }
+
+        /** @brief Returns the largest value, or 0 if there are none */
+        double max() const { return mCount == 0 ? 0.0 : mMax; }
+
+    private:
+
+        unsigned long long mCount = 0; /**<@brief Number of values added */
+        double mMean = 0.0; /**<@brief Mean of the values */
+        double mM2 = 0.0; /**<@brief Sum of squared differences from the mean */
+        double mMin = 0.0; /**<@brief Smallest value */
+        double mMax = 0.0; /**<@brief Largest value */
+
+};
+
+/**
+ * @class LogHistogram "statistics.h" "statistics.h"
+ * @brief Histogram of unsigned integers in power of two buckets.
+ *
+ * Bucket 0 counts zeros, and bucket b counts values from 2^(b-1) to 2^b - 1, so 65 buckets cover every
+ * 64-bit value. Merging adds the counts of each bucket, and is exact.
+ */
+class LogHistogram
+{
+    public:
+
+        static constexpr int kBuckets = 65; /**<@brief Number of buckets */
+
+        /**
+         * @brief Add a value
+         * @param[in] value Value to count
+         * @param[in] count Number of times to count it
+         */
+        void add(std::uint64_t value, unsigned long long count = 1) { mCounts[bucketOf(value)] += count; }
+
+        /**
+         * @brief Add the counts of another histogram
+         */
+        void merge(const LogHistogram& other);
+
+        /** @brief Returns the number of values counted in a bucket */
+        unsigned long long count(int bucket) const { return mCounts[bucket]; }
+
+        /** @brief Returns the number of values counted in every bucket */
+        unsigned long long total() const;
+
+        /** @brief Returns the bucket a value is counted in */
+        static int bucketOf(std::uint64_t value);
+
+        /** @brief Returns the smallest value counted in a bucket */
+        static std::uint64_t bucketMin(int bucket);
+
+        /** @brief Returns the largest value counted in a bucket */
+        static std::uint64_t bucketMax(int bucket);
+
+    private:
+
+        std::array<unsigned long long, kBuckets> mCounts{}; /**<@brief Values counted in each bucket */
+
+};
+
+/**
+ * @class QuantileSketch "statistics.h" "statistics.h"
+ * @brief Approximate quantiles of non-negative values, using a DDSketch.
+ *
+ * Each value is counted in the bin i = ceil(log_gamma(value)), with gamma = (1 + a) / (1 - a) for the
+ * relative accuracy a. A quantile is returned as the midpoint of its bin, which is within a relative error of
+ * a of the exact quantile. The bins grow with the logarithm of the largest value over the smallest, not the
+ * number of values, and sketches with the same accuracy merge exactly by adding their bins.
+ */
+class QuantileSketch
+{
+    public:
+
+        /**
+         * @brief Construct sketch with a relative accuracy
+         * @param[in] relativeAccuracy Relative error of returned quantiles, between 0 and 1 exclusive
+         * @throws std::invalid_argument if the accuracy is out of range
+         */
+        explicit QuantileSketch(double relativeAccuracy = 0.01);
+
+        /**
+         * @brief Add a value
+         * @throws std::invalid_argument if the value is negative
+         */
+        void add(double value);
+
+        /**
+         * @brief Add every value added to another sketch
+         * @throws std::invalid_argument if the sketches have different accuracies
+         */
+        void merge(const QuantileSketch& other);
+
+        /**
+         * @brief Returns an approximate quantile of the values
+         * @param[in] q Quantile, from 0 (smallest) to 1 (largest)
+         * @return Value within the sketch's relative accuracy of the quantile, or 0 if there are no values
+         */
+        double quantile(double q) const;
+
+        /** @brief Returns the number of values added */
+        unsigned long long count() const { return mCount; }
+
+        /** @brief Returns the relative accuracy of the sketch */
+        double relativeAccuracy() const { return mRelativeAccuracy; }
+
+    private:
+
+        /**
+         * @brief Returns the count in bin index, growing the bins to cover it
+         */
+        unsigned long long& bin(int index);
+
+        double mRelativeAccuracy; /**<@brief Relative error of returned quantiles */
+        double mGamma; /**<@brief Ratio between the bounds of each bin */
+        double mLogGamma; /**<@brief Natural log of mGamma */
+        std::vector<unsigned long long> mBins; /**<@brief Count of each bin, from bin mFirstIndex up */
+        int mFirstIndex = 0; /**<@brief Index of the bin mBins[0] counts */
+        unsigned long long mZeroCount = 0; /**<@brief Count of values too small to have a bin */
+        unsigned long long mCount = 0; /**<@brief Number of values added */
+
+};
+
+/**
+ * @class Distribution "statistics.h" "statistics.h"
+ * @brief Summary of a stream of unsigned integers: RunningStats, a LogHistogram and a QuantileSketch.
+ */
+class Distribution
+{
+    public:
+
+        /**
+         * @brief Add a value to each summary
+         */
+        void add(std::uint64_t value);
+
+        /**
+         * @brief Merge each summary of another distribution
+         */
+        void merge(const Distribution& other);
+
+        /** @brief Returns the count, mean, variance, minimum and maximum */
+        const RunningStats& stats() const { return mStats; }
+
+        /** @brief Returns the power of two histogram */
+        const LogHistogram& histogram() const { return mHistogram; }
+
+        /** @brief Returns the approximate quantiles */
+        const QuantileSketch& quantiles() const { return mQuantiles; }
+
+    private:
+
+        RunningStats mStats; /**<@brief Count, mean, variance, minimum and maximum */
+        LogHistogram mHistogram; /**<@brief Power of two histogram */
+        QuantileSketch mQuantiles; /**<@brief Approximate quantiles */
+
+};
+
+} // namespace doc
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file thread_pool.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare ThreadPool class, a fixed set of worker threads that run numbered tasks in parallel, for the
+ * parallel shuffle.
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class ThreadPool "thread_pool.h" "thread_pool.h"
+ * @brief Worker threads that run numbered tasks, started once and reused by every call to run().
+ *
+ * run(count, task) calls task(0) to task(count - 1) across the workers and the calling thread, and returns
+ * once every call has finished. Tasks are claimed in order, one at a time, so a slow task does not hold up
+ * the others. Which thread runs a task is not fixed, so tasks should only depend on their number.
+ *
+ * One run() executes at a time; a thread calling run() while another run() is in progress waits for it. The
+ * first exception thrown by a task is rethrown by run(), after the other tasks have finished.
+ */
+class ThreadPool
+{
+    public:
+
+        /**
+         * @brief Construct pool, starting its worker threads
+         * @param[in] threads Number of threads that run tasks, including the thread calling run(). 0 uses one
+         * per hardware thread.
+         */
+        explicit ThreadPool(unsigned int threads = 0);
+
+        /**
+         * @brief Stops and joins the worker threads
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Returns the number of threads that run tasks, including the thread calling run()
+         */
+        unsigned int size() const { return static_cast<unsigned int>(mWorkers.size()) + 1; }
+
+        /**
+         * @brief Calls task(index) for every index in [0, count), in parallel, and waits for them to finish
+         * @param[in] count Number of tasks
+         * @param[in] task Callable taking the std::size_t number of the task
+         */
+        void run(std::size_t count, const std::function<void(std::size_t)>& task);
+
+    private:
+
+        /**
+         * @brief Runs tasks of the current run() until none are left
+         */
+        void work();
+
+        /**
+         * @brief Worker thread: waits for each run() and works on it
+         */
+        void workerLoop();
+
+        std::mutex mRunMutex; /**<@brief Held by the thread in run(), so one run() executes at a time */
+        std::mutex mMutex; /**<@brief Guards the members below it */
+        std::condition_variable mChanged; /**<@brief Signalled when a run starts, a worker finishes, or on stop */
+        const std::function<void(std::size_t)>* mTask = nullptr; /**<@brief Task of the current run */
+        std::size_t mCount = 0; /**<@brief Number of tasks of the current run */
+        std::uint64_t mGeneration = 0; /**<@brief Number of runs started, so workers join each run once */
+        unsigned int mBusy = 0; /**<@brief Workers still working on the current run */
+        bool mStopping = false; /**<@brief If the destructor has asked the workers to stop */
+        std::exception_ptr mError; /**<@brief First exception thrown by a task of the current run */
+        std::atomic<std::size_t> mNext{0}; /**<@brief Number of the next task to claim */
+        std::vector<std::thread> mWorkers; /**<@brief Worker threads, started last */
+
+};
+
+// Definition below
+inline ThreadPool::ThreadPool(unsigned int threads)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    mWorkers.reserve(threads - 1);
+    for (unsigned int i = 1; i < threads; i++)
+        mWorkers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mChanged.notify_all();
+    for (auto& worker : mWorkers)
+        worker.join();
+}
+
+inline void ThreadPool::run(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    std::lock_guard<std::mutex> runLock(mRunMutex);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTask = &task;
+        mCount = count;
+        mNext.store(0, std::memory_order_relaxed);
+        mError = nullptr;
+        mBusy = static_cast<unsigned int>(mWorkers.size());
+        mGeneration++;
+    }
+    mChanged.notify_all();
+    work(); // calling thread works too
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mChanged.wait(lock, [this]() { return mBusy == 0; });
+    mTask = nullptr;
+    if (mError)
+        std::rethrow_exception(mError);
+}
+
+inline void ThreadPool::work()
+{
+    while (true)
+    {
+        const std::size_t index = mNext.fetch_add(1, std::memory_order_relaxed);
+        if (index >= mCount)
+            break;
+        try
+        {
+            (*mTask)(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mError)
+                mError = std::current_exception();
+        }
+    }
+}
+
+inline void ThreadPool::workerLoop()
+{
+    std::uint64_t seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mChanged.wait(lock, [this, seen]() { return mStopping || mGeneration != seen; });
+            if (mStopping)
+                return;
+            seen = mGeneration;
+        }
+        work();
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBusy--;
+        }
+        mChanged.notify_all();
+    }
+}
+
+} // namespace doc
+#endif
@@ -0,0 +1,252 @@
+/**
+ * @file trace_writer.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare TraceWriter class, that writes text formatted on many threads to a file from a background
+ * thread, and TraceWarSink, an event sink that traces a game of War through it.
+ */
+
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include "playing_card.h"
+#include "war_event_sink.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class TraceWriter "trace_writer.h" "trace_writer.h"
+ * @brief Writes large buffers of text to a file descriptor from a background thread.
+ *
+ * Each producing thread formats its records into its own Channel, a large buffer it fills without locking or
+ * allocating. A full buffer is handed to the background thread, which writes it with a single write(2) call,
+ * and the channel carries on with a recycled buffer. Records are never split between buffers, so each
+ * channel's records reach the file whole and in order, interleaved with other channels' buffers.
+ *
+ * At most maxQueued buffers wait to be written; a channel handing over a buffer beyond that waits for the
+ * background thread to catch up, so a slow file slows the producers rather than using unbounded memory.
+ *
+ * Channels must be destroyed or flushed, and the writer flushed, before the writer is destroyed. A failed
+ * write is reported by flush() as std::system_error.
+ */
+class TraceWriter
+{
+    public:
+
+        /** @brief Default size of each buffer */
+        static constexpr std::size_t kDefaultBufferBytes = 1 << 20;
+
+        /** @brief Default number of full buffers that can wait to be written */
+        static constexpr std::size_t kDefaultMaxQueued = 8;
+
+        /**
+         * @class Channel "trace_writer.h" "trace_writer.h"
+         * @brief One thread's buffer of records. Not thread safe: give each producing thread its own.
+         */
+        class Channel
+        {
+            public:
+
+                /**
+                 * @brief Construct channel that hands its buffers to writer, which must outlive the channel
+                 */
+                explicit Channel(TraceWriter& writer);
+
+                /**
+                 * @brief Hands any records left to the writer
+                 */
+                ~Channel();
+
+                Channel(Channel&& other) noexcept;
+                Channel& operator=(Channel&& other) noexcept;
+                Channel(const Channel&) = delete;
+                Channel& operator=(const Channel&) = delete;
+
+                /**
+                 * @brief Returns space for a record of up to maxBytes, handing the buffer to the writer first
+                 * if the record would not fit. Call commit() with the number of bytes used.
+                 *
+                 * Throws std::length_error if maxBytes is more than the writer's buffer size
+                 * @param[in] maxBytes Most bytes the record can take
+                 * @return Where to write the record
+                 */
+                char* claim(std::size_t maxBytes);
+
+                /**
+                 * @brief Adds the record written to the space returned by claim()
+                 * @param[in] bytes Bytes of the record, at most the maxBytes claimed
+                 */
+                void commit(std::size_t bytes) { mUsed += bytes; }
+
+                /**
+                 * @brief Adds a record of text
+                 * @param[in] text Text of the record
+                 */
+                void append(std::string_view text);
+
+                /**
+                 * @brief Hands the records so far to the writer, without waiting for them to be written
+                 */
+                void flush();
+
+            private:
+                TraceWriter* mWriter; /**<@brief Writer the buffers are handed to */
+                std::vector<char> mBuffer; /**<@brief Buffer being filled, sized to the writer's buffer size */
+                std::size_t mUsed = 0; /**<@brief Bytes of mBuffer holding records */
+        };
+
+        /**
+         * @brief Construct writer to a file descriptor, which must stay open until the writer is destroyed
+         * @param[in] fd File descriptor to write to
+         * @param[in] bufferBytes Size of each buffer
+         * @param[in] maxQueued Number of full buffers that can wait to be written
+         */
+        explicit TraceWriter(int fd, std::size_t bufferBytes = kDefaultBufferBytes,
+                std::size_t maxQueued = kDefaultMaxQueued);
+
+        /**
+         * @brief Construct writer to a file, which is created or truncated, and closed by the destructor
+         *
+         * Throws std::system_error if the file cannot be opened
+         * @param[in] path Path of the file
+         * @param[in] bufferBytes Size of each buffer
+         * @param[in] maxQueued Number of full buffers that can wait to be written
+         */
+        explicit TraceWriter(const std::string& path, std::size_t bufferBytes = kDefaultBufferBytes,
+                std::size_t maxQueued = kDefaultMaxQueued);
+
+        /**
+         * @brief Writes every buffer handed over, then stops the background thread
+         */
+        ~TraceWriter();
+
+        TraceWriter(const TraceWriter&) = delete;
+        TraceWriter& operator=(const TraceWriter&) = delete;
+
+        /**
+         * @brief Returns a new channel to this writer
+         */
+        Channel channel() { return Channel(*this); }
+
+        /**
+         * @brief Waits until every buffer handed over so far has been written
+         *
+         * Throws std::system_error if a write failed
+         */
+        void flush();
+
+        /** @brief Returns the number of bytes written so far */
+        std::uint64_t bytesWritten() const { return mBytesWritten.load(std::memory_order_relaxed); }
+
+        /** @brief Returns the number of write(2) calls made so far */
+        std::uint64_t writes() const { return mWrites.load(std::memory_order_relaxed); }
+
+        /** @brief Returns the size of each buffer */
+        std::size_t bufferBytes() const { return mBufferBytes; }
+
+    private:
+
+        /**
+         * @brief Queues a buffer to be written, waiting while maxQueued are already queued
+         */
+        void submit(std::vector<char>&& buffer, std::size_t used);
+
+        /**
+         * @brief Returns an empty buffer, recycled if one is free
+         */
+        std::vector<char> acquire();
+
+        /**
+         * @brief Background thread: writes queued buffers until stopped with nothing left to write
+         */
+        void run();
+
+        /**
+         * @brief A buffer waiting to be written
+         */
+        struct Pending
+        {
+            std::vector<char> buffer; /**<@brief Buffer to write */
+            std::size_t used; /**<@brief Bytes of the buffer to write */
+        };
+
+        int mFd; /**<@brief File descriptor written to */
+        bool mOwnsFd; /**<@brief If the destructor closes mFd */
+        std::size_t mBufferBytes; /**<@brief Size of each buffer */
+        std::size_t mMaxQueued; /**<@brief Most buffers that can wait to be written */
+        std::mutex mMutex; /**<@brief Guards the members below it */
+        std::condition_variable mChanged; /**<@brief Signalled when the queue or mWriting changes */
+        std::deque<Pending> mQueue; /**<@brief Buffers waiting to be written, in the order handed over */
+        std::vector<std::vector<char>> mFree; /**<@brief Written buffers, to be recycled */
+        bool mWriting = false; /**<@brief If the background thread is writing a buffer */
+        bool mStopping = false; /**<@brief If the destructor has asked the background thread to stop */
+        int mError = 0; /**<@brief errno of the first failed write, or 0 */
+        std::atomic<std::uint64_t> mBytesWritten{0}; /**<@brief Bytes written so far */
+        std::atomic<std::uint64_t> mWrites{0}; /**<@brief write(2) calls so far */
+        std::thread mThread; /**<@brief Background thread, started last */
+
+};
+
+/**
+ * @class TraceWarSink "trace_writer.h" "trace_writer.h"
+ * @brief Event sink that writes the same text as TextWarSink to a TraceWriter channel.
+ *
+ * Each event is formatted straight into the channel's buffer with PlayingCard::formatTo() and std::to_chars,
+ * so tracing a game allocates nothing, and the file is written from the writer's background thread. Give each
+ * thread playing games its own sink, as each sink has its own channel. The writer's buffers must hold at least
+ * 160 bytes, the space claimed for each line.
+ */
+class TraceWarSink
+{
+    public:
+
+        /**
+         * @brief Construct sink with a new channel to writer, which must outlive the sink
+         */
+        explicit TraceWarSink(TraceWriter& writer);
+
+        void cardsShown(const PlayingCard& card1, const PlayingCard& card2);
+        void warStarted();
+        void playerOutOfCards(int player);
+        void warWon(int player);
+        void warDrawn();
+        void deckReplenished(int player, std::size_t cards);
+        void gameStarted(std::size_t p1Cards, std::size_t p2Cards);
+        void turnEnded(std::size_t p1Cards, std::size_t p2Cards);
+        void gameOver(int winner, unsigned long long turns);
+        void turnAfterGameOver();
+        void gameStopped(WarOutcome outcome, unsigned long long turns);
+
+        /** @brief Returns the sink's channel, to flush it or add records of its own */
+        TraceWriter::Channel& channel() { return mChannel; }
+
+    private:
+
+        /**
+         * @brief Adds the number of cards each player holds, and the winner if there is one
+         */
+        void printScore(std::size_t p1Cards, std::size_t p2Cards);
+
+        TraceWriter::Channel mChannel; /**<@brief Channel records are written to */
+
+};
+
+} // namespace doc
+#endif
@@ -5,16 +5,30 @@
  *
  * @date 2/18/2022
  *
- * @brief Declare WarCardGame class, that simulates a game of the card game War, with the results
- * printed to standard out.
+ * @brief Declare BasicWarCardGame class, that simulates a game of the card game War, reporting its progress
+ * to an event sink. WarCardGame prints the results to standard out.
  *
  */
 
 #ifndef WAR_CARD_GAME_H
 #define WAR_CARD_GAME_H
 
+#include "compact_card.h"
 #include "deck.h"
+#include "instrumentation.h"
 #include "playing_card.h"
+#include "random_engines.h"
+#include "ring_pile.h"
+#include "seed_stream.h"
+#include "static_deck.h"
+#include "war_event_sink.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 /**
@@ -23,10 +37,96 @@
 namespace doc
 {
 
+namespace detail
+{
+
+/**
+ * @brief Appends an unsigned integer to a snapshot, least significant byte first
+ */
+template <class UInt>
+void putSnapshotValue(std::vector<std::uint8_t>& out, UInt value)
+{
+    for (std::size_t i = 0; i < sizeof(UInt); i++)
+        out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+}
+
+/**
+ * @brief Reads the values of a snapshot in order, throwing std::invalid_argument if it is too short
+ */
+class SnapshotReader
+{
+    public:
+        explicit SnapshotReader(const std::vector<std::uint8_t>& data) : mData(data) {}
+
+        template <class UInt>
+        UInt get()
+        {
+            need(sizeof(UInt));
+            UInt value = 0;
+            for (std::size_t i = 0; i < sizeof(UInt); i++)
+                value |= static_cast<UInt>(mData[mPosition++]) << (8 * i);
+            return value;
+        }
+
+        std::uint8_t getByte()
+        {
+            need(1);
+            return mData[mPosition++];
+        }
+
+        bool finished() const { return mPosition == mData.size(); }
+
+    private:
+        void need(std::size_t bytes) const
+        {
+            if (mData.size() - mPosition < bytes)
+                throw std::invalid_argument("War snapshot is truncated");
+        }
+
+        const std::vector<std::uint8_t>& mData; /**<@brief Snapshot being read */
+        std::size_t mPosition = 0; /**<@brief Position of the next value */
+};
+
+/**
+ * @brief Storage for a game's hash powers, one for every position a pile can have. A vector on the game's
+ * memory resource, sized when the game is set up.
+ */
+template <class Pile>
+struct HashPowerStorage
+{
+    using type = std::pmr::vector<std::uint64_t>;
+
+    static type make(std::pmr::memory_resource* resource) { return type(resource); }
+    static void resize(type& powers, std::size_t size) { powers.resize(size); }
+};
+
 /**
- * @class WarCardGame "war_card_game.h" "war_card_game.h"
- * @brief This class simulates a game of the card game War, played with a standard 52 card deck, with the
- * results printed to standard out.
+ * @brief With StaticPile, an array inside the game, as no pile can hold more than N cards
+ */
+template <class T, std::size_t N>
+struct HashPowerStorage<StaticPile<T, N>>
+{
+    using type = std::array<std::uint64_t, N + 1>;
+
+    static type make(std::pmr::memory_resource*) { return type{}; }
+    static void resize(type&, std::size_t) {}
+};
+
+} // namespace detail
+
+/**
+ * @brief What a player does with their win pile when their deck runs out
+ */
+enum class WinPileRule
+{
+    Shuffle, /**<@brief Shuffle the win pile to become their deck */
+    NoShuffle /**<@brief Turn the win pile into their deck as it is, so the game is deterministic */
+};
+
+/**
+ * @class BasicWarCardGame "war_card_game.h" "war_card_game.h"
+ * @brief This class simulates a game of the card game War, played with a standard 52 card deck, reporting
+ * each event of the game to an event sink.
  *
  * War involves two players, and the goal is to be the first player to win all 52 cards.
  *
@@ -43,24 +143,77 @@ namespace doc
  *  their deck to continue play with.
  *
  *  The game ends when one plyaer has won all the cards.
+ *
+ * Cards are stored as CompactCard, so piles are one byte per card and comparing cards is a table lookup.
+ * Every deck and pile is a Pile, by default a pmr::RingPile sized for all of the cards during setup, so playing
+ * a turn never allocates or copies a pile. With a StaticPile, such as in StaticWarCardGame, the cards and hash
+ * powers are stored inside the game itself, so the game never allocates. Decks shuffle with a Xoshiro256StarStar
+ * generator, 32 bytes of state each.
+ *
+ * Some games never end, particularly with WinPileRule::NoShuffle or custom cards. A turn cap ends a game
+ * after a number of turns with WarOutcome::Capped. With WinPileRule::NoShuffle the game also checks for
+ * cycles with Brent's algorithm, ending with WarOutcome::Cycle once a position repeats. Positions are
+ * compared by a hash of every deck and pile, which is updated as each card moves, so checking costs O(1) per
+ * turn; the positions are only compared in full when their hashes match, and are saved O(log turns) times.
+ *
+ * The full state of a game, including its random number generators, can be saved with snapshot() and loaded
+ * into another game with restore(), to resume a long simulation or to jump to a turn found by replayWarGame().
+ *
+ * The sink is a template parameter so that its calls are resolved at compile time. See NullWarSink for
+ * the events a sink receives. Use WarCardGame to print the game, and SilentWarCardGame to simulate it
+ * without any output cost.
  */
-class WarCardGame
+template <class Sink, class Pile = pmr::RingPile<CompactCard>>
+class BasicWarCardGame
 {
     public:
 
         /**
          * @brief Constructor sets up standard 52 card game to play
+         * @param[in] sink Receives the game's events
          */
-        WarCardGame();
+        BasicWarCardGame(Sink sink = Sink());
 
         /**
          * @brief Construct game with custom assortment of playing cards
          *
          * @param[in] cards Cards to shuffle and deal to players
-         * Must be an even number of cards for a fair game. If an odd number of cards is passed, the 
+         * Must be an even number of cards for a fair game. If an odd number of cards is passed, the
          * last card is dropped from the game.
+         * @param[in] sink Receives the game's events
          */
-        WarCardGame(const std::vector<PlayingCard>& cards);
+        BasicWarCardGame(const std::vector<PlayingCard>& cards, Sink sink = Sink());
+
+        /**
+         * @brief Construct game with custom assortment of playing cards, and a seed for the random number
+         * generators used to deal and reshuffle.
+         *
+         * Two games constructed with the same cards and seed are played identically, which allows
+         * simulations to be reproduced.
+         * @param[in] cards Cards to shuffle and deal to players (see above)
+         * @param[in] seed Seed for the game's random number generators
+         * @param[in] sink Receives the game's events
+         */
+        BasicWarCardGame(const std::vector<PlayingCard>& cards, std::uint64_t seed, Sink sink = Sink());
+
+        /**
+         * @brief Construct seeded game whose decks and piles allocate from a memory resource.
+         *
+         * The game plays identically to one constructed with the same cards and seed on the default resource.
+         * A simulation can construct many games in one arena, such as a std::pmr::monotonic_buffer_resource,
+         * and release it once they have been played. The resource must outlive the game.
+         * @param[in] cards Cards to shuffle and deal to players (see above)
+         * @param[in] seed Seed for the game's random number generators
+         * @param[in] resource Memory resource the game's decks and piles allocate from
+         * @param[in] sink Receives the game's events
+         */
+        BasicWarCardGame(const std::vector<PlayingCard>& cards, std::uint64_t seed,
+                std::pmr::memory_resource* resource, Sink sink = Sink());
+
+        /**
+         * @brief Returns the memory resource the game's decks and piles allocate from
+         */
+        std::pmr::memory_resource* memoryResource() const { return mResource; }
 
         /**
          * @brief Play a turn of the game
@@ -73,17 +226,53 @@ class WarCardGame
         void printScore() const;
 
         /**
-         * @brief Plays the game until there is a winner, printing out the score after each turn, and the
+         * @brief Plays the game until there is a winner, reporting the score after each turn, and the
          * total number of turns played.
          */
         void autoPlay();
 
         /**
-         * @brief Returns if the game is over and there is a winner
+         * @brief Returns if the game is over, because there is a winner or it was stopped
          * @return True if the game is over, false if not.
          */
         bool gameOver() const;
 
+        /**
+         * @brief Returns how the game ended
+         * @return Winner, or WarOutcome::Cycle or WarOutcome::Capped if the game was stopped, or
+         * WarOutcome::InProgress if the game is not over
+         */
+        WarOutcome outcome() const;
+
+        /**
+         * @brief Set what players do with their win pile when their deck runs out. Changing the rule restarts
+         * cycle detection.
+         * @param[in] rule Win pile rule. Games start with WinPileRule::Shuffle.
+         */
+        void setWinPileRule(WinPileRule rule);
+
+        /**
+         * @brief Returns what players do with their win pile when their deck runs out
+         */
+        WinPileRule winPileRule() const { return mWinPileRule; }
+
+        /**
+         * @brief Set the number of turns after which the game is stopped, with WarOutcome::Capped
+         * @param[in] cap Turn cap, compared to turnsPlayed(). 0, the default, is no cap.
+         */
+        void setTurnCap(unsigned long long cap) { mTurnCap = cap; }
+
+        /**
+         * @brief Returns the number of turns after which the game is stopped, or 0 for no cap
+         */
+        unsigned long long turnCap() const { return mTurnCap; }
+
+        /**
+         * @brief Returns the number of turns in the cycle, if the game ended with WarOutcome::Cycle
+         * @return Cycle length, or 0 if no cycle was found
+         */
+        unsigned long long cycleLength() const { return mCycleLength; }
+
         /**
          * @brief Returns the number of turns played so far.
          * A turn were one or more wars occur counts as one turn
@@ -91,13 +280,134 @@ class WarCardGame
          */
         unsigned long long turnsPlayed() const;
 
+        /**
+         * @brief Returns the number of wars played so far.
+         * Each consecutive war within a turn is counted separately
+         * @return Wars played
+         */
+        unsigned long long warsPlayed() const;
+
+        /**
+         * @brief Returns the number of times a player's win pile became their deck, shuffled or not.
+         * @return Reshuffles performed
+         */
+        unsigned long long reshuffles() const;
+
+        /**
+         * @brief Returns the winner of the game
+         * @return 1 if Player One won, 2 if Player Two won, or 0 if the game is not over
+         */
+        int winner() const;
+
+        /**
+         * @brief Returns the sink receiving the game's events
+         * @return Event sink
+         */
+        Sink& sink();
+
+        /** @brief Version of the snapshot format written by snapshot(). restore() also reads version 1. */
+        static constexpr std::uint32_t kSnapshotVersion = 2;
+
+        /**
+         * @brief Returns the full state of the game as a compact binary snapshot: every deck and pile, the
+         * counters, the rules and turn cap, and the state of both decks' random number generators. The sink
+         * is not included, and cycle detection starts again from the restored position.
+         *
+         * The snapshot starts with the bytes "DOCW" and kSnapshotVersion, and is the same on every platform.
+         * @return Snapshot, which restore() loads
+         */
+        std::vector<std::uint8_t> snapshot() const;
+
+        /**
+         * @brief Replaces the state of the game with a snapshot, so it plays on exactly as the game that took
+         * the snapshot would. The game's sink is kept.
+         *
+         * Throws std::invalid_argument, without changing the game, if the snapshot is not a valid snapshot of
+         * this version
+         * @param[in] data Snapshot returned by snapshot(), from a game with any sink
+         */
+        void restore(const std::vector<std::uint8_t>& data);
+
     private:
 
+        using Engine = Xoshiro256StarStar;
+        using CardPile = Pile;
+        using PlayerDeck = Deck<CompactCard, Engine, CardPile>;
+        using HashPowerStorage = detail::HashPowerStorage<Pile>;
+        using HashPowers = typename HashPowerStorage::type;
+
+        /**
+         * @brief Deal the top card of a player's deck, updating the deck's hash
+         */
+        CompactCard dealFrom(PlayerDeck& deck, std::uint64_t& hash);
+
+        /**
+         * @brief Returns an empty pile, allocating from resource if the pile has an allocator
+         */
+        static CardPile makePile(std::pmr::memory_resource* resource)
+        {
+            if constexpr (detail::HasGetAllocator<CardPile>::value)
+                return CardPile(resource);
+            else
+                return CardPile();
+        }
+
+        /**
+         * @brief Returns an empty deck, allocating from resource if its pile has an allocator
+         */
+        static PlayerDeck makeDeck(std::pmr::memory_resource* resource)
+        {
+            if constexpr (detail::HasGetAllocator<CardPile>::value)
+                return PlayerDeck(std::allocator_arg, resource);
+            else
+                return PlayerDeck();
+        }
+
+        /**
+         * @brief Add a card to the top of a win pile, updating the pile's hash
+         */
+        void addToPile(CardPile& pile, std::uint64_t& hash, CompactCard card);
+
+        /**
+         * @brief Add every card of one pile to the top of a win pile
+         * @param[in] to Win pile to add to
+         * @param[in] hash Hash of the win pile, which is updated
+         * @param[in] from Pile of cards to add, which is not modified
+         */
+        void addAll(CardPile& to, std::uint64_t& hash, const CardPile& from);
+
+        /**
+         * @brief Recompute the hash of every deck and pile, and restart cycle detection from this position
+         */
+        void rehash();
+
+        /**
+         * @brief Returns the hash of the current position, from the hash of each deck and win pile
+         */
+        std::uint64_t positionHash() const;
+
+        /**
+         * @brief Save the current position, every card of each deck and win pile, to compare in full
+         */
+        void savePosition();
+
+        /**
+         * @brief Returns if the current position is the saved position, card for card
+         */
+        bool atSavedPosition() const;
+
+        /**
+         * @brief After a turn, stop the game if it reached the turn cap or a cycle
+         */
+        void checkStop();
+
         /**
          * @brief Initialize game with cards
-         * @param[in] cards Cards to shuffle and deal out to players
+         * @param[in] cards Cards to shuffle and deal out to players. If an odd number of cards is passed,
+         * the last card is dropped.
+         * @param[in] dealDeck Deck used to shuffle and deal the cards
          */
-        void initialize(const std::vector<PlayingCard>& cards);
+        void initialize(const std::vector<PlayingCard>& cards, PlayerDeck& dealDeck);
 
         /**
          * @brief Executes war play phase of game and returns the result of the war
@@ -117,15 +427,650 @@ class WarCardGame
          */
         void replenishDecks();
 
-        Deck<PlayingCard> mP1Deck; /**<@brief Player One's deck to play from */
-        Deck<PlayingCard> mP2Deck; /**<@brief Player Two's deck to play from */
-        std::vector<PlayingCard> mP1WinPile; /**<@brief Player One's win pile, that becomes deck later */
-        std::vector<PlayingCard> mP2WinPile; /**<@brief Player Two's win pile, that becomes deck later */
-        std::vector<PlayingCard> mP1WarCards; /**<@brief Cards Player 1 has put down for war */
-        std::vector<PlayingCard> mP2WarCards; /**<@brief Cards Player 2 has put down for war */
+        // Declared first, as the decks and piles below are constructed with it
+        std::pmr::memory_resource* mResource = std::pmr::get_default_resource(); /**<@brief Allocates piles */
+        PlayerDeck mP1Deck = makeDeck(mResource); /**<@brief Player One's deck to play from */
+        PlayerDeck mP2Deck = makeDeck(mResource); /**<@brief Player Two's deck to play from */
+        CardPile mP1WinPile = makePile(mResource); /**<@brief Player One's win pile, that becomes deck later */
+        CardPile mP2WinPile = makePile(mResource); /**<@brief Player Two's win pile, that becomes deck later */
+        CardPile mP1WarCards = makePile(mResource); /**<@brief Cards Player 1 has put down for war */
+        CardPile mP2WarCards = makePile(mResource); /**<@brief Cards Player 2 has put down for war */
         unsigned long long mTurnCounter = 0; /**<@brief Counter for the number of turns played */
+        unsigned long long mWarCounter = 0; /**<@brief Counter for the number of wars played */
+        unsigned long long mReshuffleCounter = 0; /**<@brief Counter for the number of win pile reshuffles */
+        WinPileRule mWinPileRule = WinPileRule::Shuffle; /**<@brief What players do with their win piles */
+        unsigned long long mTurnCap = 0; /**<@brief Turns after which the game is stopped, 0 for no cap */
+        WarOutcome mStopped = WarOutcome::InProgress; /**<@brief Cycle or Capped once the game is stopped */
+
+        // Hash of each deck and win pile: the sum of (card id + 1) * kHashBase^position, counting positions
+        // from the bottom, modulo 2^64
+        HashPowers mHashPowers = HashPowerStorage::make(mResource); /**<@brief kHashBase^position, for every position */
+        std::uint64_t mP1DeckHash = 0; /**<@brief Hash of Player One's deck */
+        std::uint64_t mP2DeckHash = 0; /**<@brief Hash of Player Two's deck */
+        std::uint64_t mP1WinHash = 0; /**<@brief Hash of Player One's win pile */
+        std::uint64_t mP2WinHash = 0; /**<@brief Hash of Player Two's win pile */
+
+        // Brent's cycle detection: the position is saved each time the turns since it reach a power of two
+        std::uint64_t mSavedHash = 0; /**<@brief Hash of the saved position */
+        CardPile mSavedCards = makePile(mResource); /**<@brief Cards of each deck and win pile when saved */
+        std::array<std::size_t, 4> mSavedSizes{}; /**<@brief Size of each deck and win pile when saved */
+        unsigned long long mSavedPower = 1; /**<@brief Turns after which the position is saved again */
+        unsigned long long mTurnsSinceSaved = 0; /**<@brief Turns played since the position was saved */
+        unsigned long long mCycleLength = 0; /**<@brief Turns in the cycle found, 0 if none */
+
+        Sink mSink; /**<@brief Receives the game's events */
+
+        static constexpr std::uint64_t kHashBase = 0x9e3779b97f4a7c15ULL; /**<@brief Odd hash multiplier */
 
 };
 
+/** @brief Game of War that prints its progress to standard out */
+using WarCardGame = BasicWarCardGame<TextWarSink>;
+
+/** @brief Game of War that reports nothing, for simulation */
+using SilentWarCardGame = BasicWarCardGame<NullWarSink>;
+
+/** @brief Silent game of War with up to N cards, stored inside the game rather than allocated */
+template <std::size_t N = 52>
+using StaticWarCardGame = BasicWarCardGame<NullWarSink, StaticPile<CompactCard, N>>;
+
+/**
+ * @brief Re-creates a seeded game as it was after a number of turns.
+ *
+ * The turns are played silently, with the same piles and rules as the game, then the game is restored into a
+ * game with the given sink, so a game found by a simulation can be watched from an interesting turn rather than
+ * from the start. Pile must be given explicitly for a game played with other piles, e.g. a StaticWarCardGame.
+ * @param[in] cards Cards the game was constructed with
+ * @param[in] seed Seed the game was constructed with
+ * @param[in] turn Number of turns to play, as counted by turnsPlayed(). Play stops early if the game ends.
+ * @param[in] sink Receives the game's events from that turn on
+ * @param[in] rule Win pile rule the game was played with (see BasicWarCardGame::setWinPileRule())
+ * @param[in] turnCap Turn cap the game was played with, 0 for none (see BasicWarCardGame::setTurnCap())
+ * @return Game after the turns have been played
+ */
+template <class Sink, class Pile = pmr::RingPile<CompactCard>>
+BasicWarCardGame<Sink, Pile> replayWarGame(const std::vector<PlayingCard>& cards, std::uint64_t seed,
+        unsigned long long turn, Sink sink = Sink(), WinPileRule rule = WinPileRule::Shuffle,
+        unsigned long long turnCap = 0);
+
+// The two games above are compiled once, in war_card_game.cpp
+extern template class BasicWarCardGame<TextWarSink>;
+extern template class BasicWarCardGame<NullWarSink>;
+
+// Definition below
+template<class Sink, class Pile>
+BasicWarCardGame<Sink, Pile>::BasicWarCardGame(Sink sink) :
+    BasicWarCardGame(doc::buildStandardDeck(), std::move(sink))
+{
+}
+
+template<class Sink, class Pile>
+BasicWarCardGame<Sink, Pile>::BasicWarCardGame(const std::vector<PlayingCard>& cards, Sink sink) :
+    BasicWarCardGame(cards, seeding::threadStream().next(), std::pmr::get_default_resource(), std::move(sink))
+{
+}
+
+template<class Sink, class Pile>
+BasicWarCardGame<Sink, Pile>::BasicWarCardGame(const std::vector<PlayingCard>& cards, std::uint64_t seed, Sink sink) :
+    BasicWarCardGame(cards, seed, std::pmr::get_default_resource(), std::move(sink))
+{
+}
+
+template<class Sink, class Pile>
+BasicWarCardGame<Sink, Pile>::BasicWarCardGame(const std::vector<PlayingCard>& cards, std::uint64_t seed,
+        std::pmr::memory_resource* resource, Sink sink) :
+    mResource(resource), mSink(std::move(sink))
+{
+    // Expand the seed into independent seeds for each deck
+    SeedStream deckSeeds(seed);
+    PlayerDeck dealDeck = makeDeck(mResource);
+    dealDeck.seed(deckSeeds.next());
+    mP1Deck.seed(deckSeeds.next());
+    mP2Deck.seed(deckSeeds.next());
+    initialize(cards, dealDeck);
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::playTurn()
+{
+    if (!gameOver())
+    {
+        const instrumentation::TurnScope turnScope;
+        mTurnCounter++;
+        replenishDecks();
+
+        const CompactCard card1 = dealFrom(mP1Deck, mP1DeckHash);
+        const CompactCard card2 = dealFrom(mP2Deck, mP2DeckHash);
+        mSink.cardsShown(card1.toPlayingCard(), card2.toPlayingCard());
+        if (card1.warStrength() == card2.warStrength())
+        {
+            const int winner = war();
+            if (winner == 1)
+            {
+                mSink.warWon(1);
+                addToPile(mP1WinPile, mP1WinHash, card1);
+                addToPile(mP1WinPile, mP1WinHash, card2);
+                addAll(mP1WinPile, mP1WinHash, mP1WarCards);
+                addAll(mP1WinPile, mP1WinHash, mP2WarCards);
+            }
+            else if (winner == 2)
+            {
+                mSink.warWon(2);
+                addToPile(mP2WinPile, mP2WinHash, card1);
+                addToPile(mP2WinPile, mP2WinHash, card2);
+                addAll(mP2WinPile, mP2WinHash, mP2WarCards);
+                addAll(mP2WinPile, mP2WinHash, mP1WarCards);
+            }
+            else // DRAW! Everyone gets their cards back
+            {
+                mSink.warDrawn();
+                addToPile(mP1WinPile, mP1WinHash, card1);
+                addToPile(mP2WinPile, mP2WinHash, card2);
+                addAll(mP1WinPile, mP1WinHash, mP1WarCards);
+                addAll(mP2WinPile, mP2WinHash, mP2WarCards);
+            }
+            mP1WarCards.clear();
+            mP2WarCards.clear();
+        }
+        else if (card1.warStrength() > card2.warStrength())
+        {
+            //player 1 wins
+            addToPile(mP1WinPile, mP1WinHash, card1);
+            addToPile(mP1WinPile, mP1WinHash, card2);
+        }
+        else
+        {
+            // player 2 wins
+            addToPile(mP2WinPile, mP2WinHash, card1);
+            addToPile(mP2WinPile, mP2WinHash, card2);
+        }
+        checkStop();
+    }
+    else
+    {
+        mSink.turnAfterGameOver();
+    }
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::printScore() const
+{
+    const unsigned int p1Score = mP1Deck.size() + mP1WinPile.size();
+    const unsigned int p2Score = mP2Deck.size() + mP2WinPile.size();
+
+    std::cout << "Player One has " << p1Score << " cards left.   Player Two has " << p2Score <<
+        " cards left.\n";
+    if (p1Score == 0)
+        std:: cout << "Player Two has won!\n";
+    else if (p2Score == 0)
+        std:: cout << "Player One has won!\n";
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::autoPlay()
+{
+    mSink.gameStarted(mP1Deck.size() + mP1WinPile.size(), mP2Deck.size() + mP2WinPile.size());
+    while(!gameOver())
+    {
+        playTurn();
+        mSink.turnEnded(mP1Deck.size() + mP1WinPile.size(), mP2Deck.size() + mP2WinPile.size());
+    }
+    mSink.gameOver(winner(), mTurnCounter);
+}
+
+template<class Sink, class Pile>
+bool BasicWarCardGame<Sink, Pile>::gameOver() const
+{
+    if ((mP1Deck.empty() && mP1WinPile.empty()) ||
+        (mP2Deck.empty() && mP2WinPile.empty()))
+    {
+        return true;
+    }
+    else
+        return mStopped != WarOutcome::InProgress;
+}
+
+template<class Sink, class Pile>
+WarOutcome BasicWarCardGame<Sink, Pile>::outcome() const
+{
+    const int gameWinner = winner();
+    if (gameWinner == 1)
+        return WarOutcome::PlayerOneWon;
+    else if (gameWinner == 2)
+        return WarOutcome::PlayerTwoWon;
+    else
+        return mStopped;
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::setWinPileRule(WinPileRule rule)
+{
+    if (rule == mWinPileRule)
+        return;
+    mWinPileRule = rule;
+    rehash();
+}
+
+template<class Sink, class Pile>
+unsigned long long BasicWarCardGame<Sink, Pile>::turnsPlayed() const
+{
+    return mTurnCounter;
+}
+
+template<class Sink, class Pile>
+unsigned long long BasicWarCardGame<Sink, Pile>::warsPlayed() const
+{
+    return mWarCounter;
+}
+
+template<class Sink, class Pile>
+unsigned long long BasicWarCardGame<Sink, Pile>::reshuffles() const
+{
+    return mReshuffleCounter;
+}
+
+template<class Sink, class Pile>
+int BasicWarCardGame<Sink, Pile>::winner() const
+{
+    if (mP2Deck.empty() && mP2WinPile.empty())
+        return 1;
+    else if (mP1Deck.empty() && mP1WinPile.empty())
+        return 2;
+    else
+        return 0;
+}
+
+template<class Sink, class Pile>
+Sink& BasicWarCardGame<Sink, Pile>::sink()
+{
+    return mSink;
+}
+
+template<class Sink, class Pile>
+std::vector<std::uint8_t> BasicWarCardGame<Sink, Pile>::snapshot() const
+{
+    std::vector<std::uint8_t> data = {'D', 'O', 'C', 'W'};
+    detail::putSnapshotValue(data, kSnapshotVersion);
+    detail::putSnapshotValue(data, std::uint64_t(mTurnCounter));
+    detail::putSnapshotValue(data, std::uint64_t(mWarCounter));
+    detail::putSnapshotValue(data, std::uint64_t(mReshuffleCounter));
+    data.push_back(static_cast<std::uint8_t>(mWinPileRule));
+    detail::putSnapshotValue(data, std::uint64_t(mTurnCap));
+    data.push_back(static_cast<std::uint8_t>(mStopped));
+    detail::putSnapshotValue(data, std::uint64_t(mCycleLength));
+    for (const PlayerDeck* deck : {&mP1Deck, &mP2Deck})
+    {
+        for (const std::uint64_t word : deck->generator().state())
+            detail::putSnapshotValue(data, word);
+    }
+
+    auto putPile = [&data](const auto& pile)
+    {
+        detail::putSnapshotValue(data, static_cast<std::uint32_t>(pile.size()));
+        for (const auto& card : pile)
+            data.push_back(card.id());
+    };
+    putPile(mP1Deck.contents());
+    putPile(mP2Deck.contents());
+    for (const CardPile* pile : {&mP1WinPile, &mP2WinPile, &mP1WarCards, &mP2WarCards})
+        putPile(*pile);
+    return data;
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::restore(const std::vector<std::uint8_t>& data)
+{
+    detail::SnapshotReader reader(data);
+    if (reader.getByte() != 'D' || reader.getByte() != 'O' || reader.getByte() != 'C' || reader.getByte() != 'W')
+        throw std::invalid_argument("Not a War snapshot");
+    const std::uint32_t version = reader.get<std::uint32_t>();
+    if (version != 1 && version != kSnapshotVersion)
+        throw std::invalid_argument("Unsupported War snapshot version");
+
+    const std::uint64_t turns = reader.get<std::uint64_t>();
+    const std::uint64_t wars = reader.get<std::uint64_t>();
+    const std::uint64_t reshuffles = reader.get<std::uint64_t>();
+
+    // Version 1 snapshots have no rules, and were never stopped
+    WinPileRule rule = WinPileRule::Shuffle;
+    std::uint64_t turnCap = 0;
+    WarOutcome stopped = WarOutcome::InProgress;
+    std::uint64_t cycleLength = 0;
+    if (version >= 2)
+    {
+        const std::uint8_t ruleValue = reader.getByte();
+        turnCap = reader.get<std::uint64_t>();
+        const std::uint8_t stoppedValue = reader.getByte();
+        cycleLength = reader.get<std::uint64_t>();
+        if (ruleValue > static_cast<std::uint8_t>(WinPileRule::NoShuffle) ||
+                (stoppedValue != static_cast<std::uint8_t>(WarOutcome::InProgress) &&
+                 stoppedValue != static_cast<std::uint8_t>(WarOutcome::Cycle) &&
+                 stoppedValue != static_cast<std::uint8_t>(WarOutcome::Capped)))
+            throw std::invalid_argument("War snapshot has invalid rules");
+        rule = static_cast<WinPileRule>(ruleValue);
+        stopped = static_cast<WarOutcome>(stoppedValue);
+    }
+    std::array<std::uint64_t, 4> engineStates[2];
+    for (auto& engineState : engineStates)
+    {
+        for (auto& word : engineState)
+            word = reader.get<std::uint64_t>();
+    }
+
+    // Read every pile before changing the game, so an invalid snapshot leaves it unchanged
+    std::vector<CompactCard> piles[6];
+    std::size_t total = 0;
+    for (auto& pile : piles)
+    {
+        const std::uint32_t size = reader.get<std::uint32_t>();
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            const std::uint8_t id = reader.getByte();
+            if (id >= CompactCard::kIdCount)
+                throw std::invalid_argument("War snapshot has an invalid card");
+            pile.push_back(CompactCard(id));
+        }
+        total += size;
+    }
+    if (!reader.finished())
+        throw std::invalid_argument("War snapshot has unexpected data");
+
+    Engine p1Engine;
+    Engine p2Engine;
+    p1Engine.setState(engineStates[0]);
+    p2Engine.setState(engineStates[1]);
+
+    // Every pile can hold all of the cards, as initialize() sets up
+    for (CardPile* pile : {&mP1WinPile, &mP2WinPile, &mP1WarCards, &mP2WarCards, &mSavedCards})
+        pile->reserve(total);
+    mP1Deck.reserve(total);
+    mP2Deck.reserve(total);
+
+    mP1Deck.assign(std::move(piles[0]));
+    mP2Deck.assign(std::move(piles[1]));
+    mP1WinPile.assign(piles[2].begin(), piles[2].end());
+    mP2WinPile.assign(piles[3].begin(), piles[3].end());
+    mP1WarCards.assign(piles[4].begin(), piles[4].end());
+    mP2WarCards.assign(piles[5].begin(), piles[5].end());
+    mP1Deck.generator() = p1Engine;
+    mP2Deck.generator() = p2Engine;
+    mTurnCounter = turns;
+    mWarCounter = wars;
+    mReshuffleCounter = reshuffles;
+    mWinPileRule = rule;
+    mTurnCap = turnCap;
+    mStopped = stopped;
+    mCycleLength = cycleLength;
+    rehash();
+}
+
+template<class Sink, class Pile>
+BasicWarCardGame<Sink, Pile> replayWarGame(const std::vector<PlayingCard>& cards, std::uint64_t seed,
+        unsigned long long turn, Sink sink, WinPileRule rule, unsigned long long turnCap)
+{
+    BasicWarCardGame<NullWarSink, Pile> silent(cards, seed);
+    silent.setWinPileRule(rule);
+    silent.setTurnCap(turnCap);
+    while (!silent.gameOver() && silent.turnsPlayed() < turn)
+        silent.playTurn();
+
+    BasicWarCardGame<Sink, Pile> game(cards, std::move(sink));
+    game.restore(silent.snapshot());
+    return game;
+}
+
+/*
+ * Recursive function if multiple wars occur
+ *
+ * For war, each player draws 2 cards. First card is "face down", aka just goes straight into
+ * the warCards pile. The second is compared to decide who won.
+ *
+ * Edge cases to handle:
+ *  - If player doesn't have enough cards to complete the war, they lose.
+ *  - If neither do, the one who runs out first loses.
+ *  - If both players run out simultaneously, it's a draw, they both get all their cards back.
+ */
+template<class Sink, class Pile>
+int BasicWarCardGame<Sink, Pile>::war()
+{
+    const instrumentation::WarScope warScope;
+    mWarCounter++;
+    mSink.warStarted();
+
+    replenishDecks(); // if war continues, need to replenish from win pile to continue the war.
+
+    if (mP1Deck.empty() && mP2Deck.empty())
+        return 3;
+    else if (mP1Deck.empty())
+    {
+        mSink.playerOutOfCards(1);
+        return 2;
+    }
+    else if (mP2Deck.empty())
+    {
+        mSink.playerOutOfCards(2);
+        return 1;
+    }
+
+    mP1WarCards.push_back(dealFrom(mP1Deck, mP1DeckHash)); // face down cards
+    mP2WarCards.push_back(dealFrom(mP2Deck, mP2DeckHash));
+
+    if (mP1Deck.empty() && mP2Deck.empty())
+        return 3;
+    else if (mP1Deck.empty())
+    {
+        mSink.playerOutOfCards(1);
+        return 2;
+    }
+    else if (mP2Deck.empty())
+    {
+        mSink.playerOutOfCards(2);
+        return 1;
+    }
+
+    const CompactCard card1 = dealFrom(mP1Deck, mP1DeckHash); // face up cards to compare
+    const CompactCard card2 = dealFrom(mP2Deck, mP2DeckHash);
+    mP1WarCards.push_back(card1);
+    mP2WarCards.push_back(card2);
+
+    mSink.cardsShown(card1.toPlayingCard(), card2.toPlayingCard());
+    if (card1.warStrength() == card2.warStrength())
+        return war(); // recursive
+    else if (card1.warStrength() > card2.warStrength())
+        return 1;
+    else
+        return 2;
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::replenishDecks()
+{
+    if (mP1Deck.empty())
+    {
+        if (mWinPileRule == WinPileRule::Shuffle)
+            mP1Deck.shuffleIn(mP1WinPile);
+        else
+            mP1Deck.placeUnder(mP1WinPile);
+        // The hash of a shuffled deck is not kept up to date, since it is only used without shuffling
+        mP1DeckHash = mP1WinHash;
+        mP1WinHash = 0;
+        mReshuffleCounter++;
+        DOC_COUNT(reshuffles, 1);
+        mSink.deckReplenished(1, mP1Deck.size());
+    }
+
+    if (mP2Deck.empty())
+    {
+        if (mWinPileRule == WinPileRule::Shuffle)
+            mP2Deck.shuffleIn(mP2WinPile);
+        else
+            mP2Deck.placeUnder(mP2WinPile);
+        mP2DeckHash = mP2WinHash;
+        mP2WinHash = 0;
+        mReshuffleCounter++;
+        DOC_COUNT(reshuffles, 1);
+        mSink.deckReplenished(2, mP2Deck.size());
+    }
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::initialize(const std::vector<PlayingCard>& cards, PlayerDeck& dealDeck)
+{
+    const size_t count = cards.size() - (cards.size() % 2); // drop the last card if there are an odd number
+    dealDeck.reserve(count);
+    for (size_t i = 0; i < count; i++)
+        dealDeck.emplace_top(cards[i]);
+    dealDeck.shuffle();
+
+    // max any pile will ever be is total amount of cards
+    for (CardPile* pile : {&mP1WinPile, &mP2WinPile, &mP1WarCards, &mP2WarCards, &mSavedCards})
+        pile->reserve(count);
+    mP1Deck.reserve(count);
+    mP2Deck.reserve(count);
+
+    while (!dealDeck.empty())
+    {
+        mP1WinPile.push_back(dealDeck.deal_card());
+        mP2WinPile.push_back(dealDeck.deal_card());
+    }
+
+    // Each deck takes over its pile's storage, rather than copying the dealt cards
+    mP1Deck.shuffleIn(mP1WinPile);
+    mP2Deck.shuffleIn(mP2WinPile);
+    rehash();
+}
+
+template<class Sink, class Pile>
+CompactCard BasicWarCardGame<Sink, Pile>::dealFrom(PlayerDeck& deck, std::uint64_t& hash)
+{
+    const std::size_t top = deck.size() - 1;
+    const CompactCard card = deck.deal_card();
+    hash -= (card.id() + 1u) * mHashPowers[top];
+    return card;
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::addToPile(CardPile& pile, std::uint64_t& hash, CompactCard card)
+{
+    hash += (card.id() + 1u) * mHashPowers[pile.size()];
+    pile.push_back(card);
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::addAll(CardPile& to, std::uint64_t& hash, const CardPile& from)
+{
+    for (const auto& card : from)
+        addToPile(to, hash, card);
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::rehash()
+{
+    const std::size_t total = mP1Deck.size() + mP2Deck.size() + mP1WinPile.size() + mP2WinPile.size() +
+        mP1WarCards.size() + mP2WarCards.size();
+    HashPowerStorage::resize(mHashPowers, total + 1);
+    std::uint64_t power = 1;
+    for (auto& hashPower : mHashPowers)
+    {
+        hashPower = power;
+        power *= kHashBase;
+    }
+
+    auto hashOf = [this](const auto& pile)
+    {
+        std::uint64_t hash = 0;
+        std::size_t position = 0;
+        for (const auto& card : pile)
+            hash += (card.id() + 1u) * mHashPowers[position++];
+        return hash;
+    };
+    mP1DeckHash = hashOf(mP1Deck.cards());
+    mP2DeckHash = hashOf(mP2Deck.cards());
+    mP1WinHash = hashOf(mP1WinPile);
+    mP2WinHash = hashOf(mP2WinPile);
+
+    // Only games without shuffling can repeat a position, so only they save one
+    mSavedHash = positionHash();
+    if (mWinPileRule == WinPileRule::NoShuffle)
+        savePosition();
+    mSavedPower = 1;
+    mTurnsSinceSaved = 0;
+}
+
+template<class Sink, class Pile>
+std::uint64_t BasicWarCardGame<Sink, Pile>::positionHash() const
+{
+    // Combine so that swapping cards between decks and piles changes the hash
+    const std::uint64_t kMix = 0xbf58476d1ce4e5b9ULL;
+    return ((mP1DeckHash * kMix + mP1WinHash) * kMix + mP2DeckHash) * kMix + mP2WinHash;
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::savePosition()
+{
+    // mSavedCards has the capacity for every card, reserved in initialize()
+    mSavedCards.clear();
+    const CardPile* piles[4] = {&mP1Deck.cards(), &mP1WinPile, &mP2Deck.cards(), &mP2WinPile};
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        mSavedSizes[i] = piles[i]->size();
+        for (const auto& card : *piles[i])
+            mSavedCards.push_back(card);
+    }
+}
+
+template<class Sink, class Pile>
+bool BasicWarCardGame<Sink, Pile>::atSavedPosition() const
+{
+    const CardPile* piles[4] = {&mP1Deck.cards(), &mP1WinPile, &mP2Deck.cards(), &mP2WinPile};
+    auto saved = mSavedCards.begin();
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        if (piles[i]->size() != mSavedSizes[i])
+            return false;
+        for (const auto& card : *piles[i])
+        {
+            if (card.id() != saved->id())
+                return false;
+            ++saved;
+        }
+    }
+    return true;
+}
+
+template<class Sink, class Pile>
+void BasicWarCardGame<Sink, Pile>::checkStop()
+{
+    if (winner() != 0)
+        return;
+
+    if (mTurnCap != 0 && mTurnCounter >= mTurnCap)
+    {
+        mStopped = WarOutcome::Capped;
+        mSink.gameStopped(mStopped, mTurnCounter);
+        return;
+    }
+
+    // With shuffling the random number generators never repeat, so neither does the game
+    if (mWinPileRule == WinPileRule::NoShuffle)
+    {
+        mTurnsSinceSaved++;
+        const std::uint64_t hash = positionHash();
+        if (hash == mSavedHash && atSavedPosition())
+        {
+            mCycleLength = mTurnsSinceSaved;
+            mStopped = WarOutcome::Cycle;
+            mSink.gameStopped(mStopped, mTurnCounter);
+        }
+        else if (mTurnsSinceSaved == mSavedPower)
+        {
+            mSavedHash = hash;
+            savePosition();
+            mSavedPower *= 2;
+            mTurnsSinceSaved = 0;
+        }
+    }
+}
+
 } // namespace doc
 #endif
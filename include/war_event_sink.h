@@ -0,0 +1,125 @@
+/**
+ * @file war_event_sink.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare event sinks, that receive the events of a game of War as it is played.
+ *
+ */
+
+#ifndef WAR_EVENT_SINK_H
+#define WAR_EVENT_SINK_H
+
+#include "playing_card.h"
+#include <cstddef>
+#include <iosfwd>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @brief How a game of War ended, or that it has not
+ */
+enum class WarOutcome
+{
+    InProgress, /**<@brief The game has not ended */
+    PlayerOneWon, /**<@brief Player One won every card */
+    PlayerTwoWon, /**<@brief Player Two won every card */
+    Cycle, /**<@brief The game returned to an earlier position, so it would repeat forever */
+    Capped /**<@brief The game reached its turn cap without a winner */
+};
+
+/**
+ * @class NullWarSink "war_event_sink.h" "war_event_sink.h"
+ * @brief Event sink that ignores every event.
+ *
+ * Every method is empty and inline, so a game played with this sink compiles down to the game logic alone,
+ * without building any strings or touching any stream. Use it for silent simulation.
+ *
+ * A sink is any class with the methods below. Players are numbered 1 and 2.
+ */
+struct NullWarSink
+{
+    /** @brief Each player showed a card, at the start of a turn or during a war */
+    void cardsShown(const PlayingCard&, const PlayingCard&) {}
+
+    /** @brief The shown cards were the same rank, and a war has started */
+    void warStarted() {}
+
+    /** @brief A player ran out of cards and could not continue the war */
+    void playerOutOfCards(int) {}
+
+    /** @brief A player won the war, and takes all of the cards put down */
+    void warWon(int) {}
+
+    /** @brief Both players ran out of cards during the war, and each takes back their own cards */
+    void warDrawn() {}
+
+    /** @brief A player's win pile was shuffled to become their deck */
+    void deckReplenished(int, std::size_t) {}
+
+    /** @brief autoPlay() is starting the game, with each player holding the given number of cards */
+    void gameStarted(std::size_t, std::size_t) {}
+
+    /** @brief autoPlay() finished a turn, after which each player holds the given number of cards */
+    void turnEnded(std::size_t, std::size_t) {}
+
+    /** @brief autoPlay() finished the game, with the given winner and number of turns played */
+    void gameOver(int, unsigned long long) {}
+
+    /** @brief A turn was requested after the game ended */
+    void turnAfterGameOver() {}
+
+    /** @brief The game was stopped without a winner (WarOutcome::Cycle or Capped), after the given turns */
+    void gameStopped(WarOutcome, unsigned long long) {}
+};
+
+/**
+ * @class TextWarSink "war_event_sink.h" "war_event_sink.h"
+ * @brief Event sink that prints a game's progress as text, the way WarCardGame always has.
+ */
+class TextWarSink
+{
+    public:
+
+        /**
+         * @brief Construct sink that prints to standard out
+         */
+        TextWarSink();
+
+        /**
+         * @brief Construct sink that prints to a stream
+         * @param[in] out Stream to print to. Must outlive the sink.
+         */
+        explicit TextWarSink(std::ostream& out);
+
+        void cardsShown(const PlayingCard& card1, const PlayingCard& card2);
+        void warStarted();
+        void playerOutOfCards(int player);
+        void warWon(int player);
+        void warDrawn();
+        void deckReplenished(int player, std::size_t cards);
+        void gameStarted(std::size_t p1Cards, std::size_t p2Cards);
+        void turnEnded(std::size_t p1Cards, std::size_t p2Cards);
+        void gameOver(int winner, unsigned long long turns);
+        void turnAfterGameOver();
+        void gameStopped(WarOutcome outcome, unsigned long long turns);
+
+    private:
+
+        /**
+         * @brief Print the number of cards each player holds, and the winner if there is one
+         */
+        void printScore(std::size_t p1Cards, std::size_t p2Cards);
+
+        std::ostream* mOut; /**<@brief Stream to print to */
+
+};
+
+} // namespace doc
+#endif
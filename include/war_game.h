@@ -0,0 +1,405 @@
+/**
+ * @file war_game.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare WarGame class, that simulates a silent game of War between any number of players.
+ */
+
+#ifndef WAR_GAME_H
+#define WAR_GAME_H
+
+#include "compact_card.h"
+#include "deck.h"
+#include "playing_card.h"
+#include "random_engines.h"
+#include "ring_pile.h"
+#include "seed_stream.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @class WarGame "war_game.h" "war_game.h"
+ * @brief This class simulates a game of War between NPlayers players, without reporting its progress.
+ *
+ * How to play:
+ *  Each player still in the game shows a card, and the highest card takes every card shown. If two or more
+ *  players tie for the highest card, only they go to war: each puts down one card face down and shows a second,
+ *  and the highest of those takes every card put down in the turn. Ties repeat the war between the players
+ *  still tied.
+ *
+ *  A player who runs out of cards during a war drops out of it. If every player in the war runs out, each
+ *  takes back the cards they put down, and the cards of the players who lost the turn are dealt out between
+ *  them one at a time. A player's win pile is shuffled to become their deck when their deck
+ *  runs out, and a player with no cards left at the end of a turn is eliminated. The last player left wins.
+ *
+ *  If every player in the game holds cards of the same strength, every turn ends in that draw, so the game is
+ *  stopped as a stalemate without a winner. No other deal can be drawn forever, but games can be long, so
+ *  setTurnCap() bounds the turns a game may take.
+ *
+ * Players are numbered 1 to NPlayers. Their decks and piles are kept in arrays, and the players in a turn
+ * or war are a bitmask, so the loops over players have a fixed count and are unrolled for each NPlayers.
+ * Like WarCardGame, cards are stored as CompactCard in RingPiles sized during setup, so turns never allocate.
+ *
+ * Unlike WarCardGame, a player runs out of cards during a war only when their deck and win pile are both
+ * empty, so WarGame<2> does not play exactly the same games as WarCardGame.
+ */
+template <std::size_t NPlayers>
+class WarGame
+{
+    static_assert(NPlayers >= 2 && NPlayers <= 32, "WarGame supports 2 to 32 players");
+
+    public:
+
+        /**
+         * @brief Construct game with an assortment of playing cards, seeded from this thread's SeedStream
+         * @param[in] cards Cards to shuffle and deal to players. If the cards do not divide evenly between the
+         * players, the last cards are dropped from the game.
+         */
+        explicit WarGame(const std::vector<PlayingCard>& cards = buildStandardDeck());
+
+        /**
+         * @brief Construct game with an assortment of playing cards, and a seed for the random number
+         * generators used to deal and reshuffle.
+         *
+         * Two games constructed with the same cards and seed are played identically.
+         * @param[in] cards Cards to shuffle and deal to players (see above)
+         * @param[in] seed Seed for the game's random number generators
+         */
+        WarGame(const std::vector<PlayingCard>& cards, std::uint64_t seed);
+
+        /**
+         * @brief Play a turn of the game. Does nothing if the game is over.
+         */
+        void playTurn();
+
+        /**
+         * @brief Plays turns until the game is over
+         */
+        void autoPlay();
+
+        /**
+         * @brief Returns if the game is over, because one player is left, the turn cap was reached, or the
+         * game is a stalemate
+         */
+        bool gameOver() const { return mActive == (mActive & -mActive) || mCapped || mStalemate; }
+
+        /**
+         * @brief Returns the winner of the game
+         * @return Number of the winning player, 1 to NPlayers, or 0 if the game is not over, was capped or is a
+         * stalemate
+         */
+        int winner() const;
+
+        /**
+         * @brief Returns the number of players still in the game
+         */
+        int playersLeft() const;
+
+        /**
+         * @brief Returns the number of cards a player holds, in their deck and win pile
+         * @param[in] player Player number, 1 to NPlayers
+         */
+        std::size_t cardCount(int player) const;
+
+        /**
+         * @brief Returns the turn on which a player was eliminated
+         * @param[in] player Player number, 1 to NPlayers
+         * @return Turn number, or 0 if the player has not been eliminated
+         */
+        unsigned long long eliminatedOnTurn(int player) const { return mEliminatedOnTurn[player - 1]; }
+
+        /**
+         * @brief Set the number of turns after which the game is stopped without a winner
+         * @param[in] cap Turn cap. 0, the default, is no cap.
+         */
+        void setTurnCap(unsigned long long cap) { mTurnCap = cap; }
+
+        /**
+         * @brief Returns if the game was stopped by the turn cap
+         */
+        bool capped() const { return mCapped; }
+
+        /**
+         * @brief Returns if the game was stopped because every player holds cards of the same strength, so no
+         * turn can be won
+         */
+        bool stalemate() const { return mStalemate; }
+
+        /** @brief Returns the number of turns played so far */
+        unsigned long long turnsPlayed() const { return mTurnCounter; }
+
+        /** @brief Returns the number of wars played so far, counting each war within a turn */
+        unsigned long long warsPlayed() const { return mWarCounter; }
+
+        /** @brief Returns the number of times a player's win pile was shuffled to become their deck */
+        unsigned long long reshuffles() const { return mReshuffleCounter; }
+
+    private:
+
+        using Engine = Xoshiro256StarStar;
+        using CardPile = RingPile<CompactCard>;
+        using PlayerDeck = Deck<CompactCard, Engine, CardPile>;
+        using PlayerMask = std::uint32_t; /**<@brief Bit p - 1 set for each player p in a set of players */
+
+        /**
+         * @brief Deal and shuffle the cards out to the players
+         */
+        void initialize(const std::vector<PlayingCard>& cards, Deck<CompactCard, Engine>& dealDeck);
+
+        /**
+         * @brief Put down a card from a player, shuffling their win pile into their deck first if needed
+         * @param[in] player Player index, 0 to NPlayers - 1
+         * @return False if the player has no cards left
+         */
+        bool putDown(std::size_t player);
+
+        PlayerMask mActive = 0; /**<@brief Players still in the game */
+        std::array<PlayerDeck, NPlayers> mDecks; /**<@brief Each player's deck to play from */
+        std::array<CardPile, NPlayers> mWinPiles; /**<@brief Each player's win pile, that becomes their deck */
+        std::array<CardPile, NPlayers> mPutDown; /**<@brief Cards each player has put down this turn */
+        std::array<unsigned long long, NPlayers> mEliminatedOnTurn{}; /**<@brief Turn each player went out */
+        unsigned long long mTurnCounter = 0; /**<@brief Counter for the number of turns played */
+        unsigned long long mWarCounter = 0; /**<@brief Counter for the number of wars played */
+        unsigned long long mReshuffleCounter = 0; /**<@brief Counter for the number of win pile reshuffles */
+        unsigned long long mTurnCap = 0; /**<@brief Turns after which the game is stopped, 0 for no cap */
+        bool mCapped = false; /**<@brief If the game was stopped by the turn cap */
+        bool mStalemate = false; /**<@brief If the game was stopped because no turn can be won */
+
+};
+
+// Definition below
+template<std::size_t NPlayers>
+WarGame<NPlayers>::WarGame(const std::vector<PlayingCard>& cards) :
+    WarGame(cards, seeding::threadStream().next())
+{
+}
+
+template<std::size_t NPlayers>
+WarGame<NPlayers>::WarGame(const std::vector<PlayingCard>& cards, std::uint64_t seed)
+{
+    // Expand the seed into independent seeds for each deck
+    SeedStream deckSeeds(seed);
+    Deck<CompactCard, Engine> dealDeck;
+    dealDeck.seed(deckSeeds.next());
+    for (auto& deck : mDecks)
+        deck.seed(deckSeeds.next());
+    initialize(cards, dealDeck);
+}
+
+template<std::size_t NPlayers>
+void WarGame<NPlayers>::playTurn()
+{
+    if (gameOver())
+        return;
+    mTurnCounter++;
+
+    // Every player in the game shows a card
+    PlayerMask contenders = 0;
+    for (std::size_t player = 0; player < NPlayers; player++)
+    {
+        if ((mActive >> player & 1) && putDown(player))
+            contenders |= PlayerMask(1) << player;
+    }
+
+    // The highest card wins, or the players tied for it go to war, until one player is left or none are
+    PlayerMask war = 0;
+    while (contenders != 0 && contenders != (contenders & -contenders))
+    {
+        int best = -1;
+        PlayerMask tied = 0;
+        for (std::size_t player = 0; player < NPlayers; player++)
+        {
+            if (contenders >> player & 1)
+            {
+                const int strength = mPutDown[player].back().warStrength();
+                if (strength > best)
+                {
+                    best = strength;
+                    tied = 0;
+                }
+                if (strength == best)
+                    tied |= PlayerMask(1) << player;
+            }
+        }
+        contenders = tied;
+        if (contenders == (contenders & -contenders))
+            break;
+
+        // War: a card face down, then a card face up. Players who run out drop out of the war.
+        mWarCounter++;
+        war = contenders;
+        for (int card = 0; card < 2; card++)
+        {
+            for (std::size_t player = 0; player < NPlayers; player++)
+            {
+                if ((contenders >> player & 1) && !putDown(player))
+                    contenders &= ~(PlayerMask(1) << player);
+            }
+        }
+    }
+
+    if (contenders == 0)
+    {
+        // Everyone in the last war ran out, holding every card they had left, and if no one else was in the
+        // turn and all their cards are the same strength, every turn will end the same way
+        if (war == mActive)
+        {
+            std::size_t first = 0;
+            while (!(war >> first & 1))
+                first++;
+            const int strength = mPutDown[first].front().warStrength();
+            bool sameStrength = true;
+            for (const auto& pile : mPutDown)
+            {
+                for (const auto& card : pile)
+                    sameStrength = sameStrength && card.warStrength() == strength;
+            }
+            mStalemate = sameStrength;
+        }
+
+        // Each player in the war takes back their own cards, and the cards of the players who lost the turn
+        // are dealt out between them
+        std::size_t taker = 0;
+        for (std::size_t player = 0; player < NPlayers; player++)
+        {
+            if (war >> player & 1)
+            {
+                for (const auto& card : mPutDown[player])
+                    mWinPiles[player].push_back(card);
+                mPutDown[player].clear();
+            }
+        }
+        for (std::size_t player = 0; player < NPlayers; player++)
+        {
+            for (const auto& card : mPutDown[player])
+            {
+                while (!(war >> taker & 1))
+                    taker = (taker + 1) % NPlayers;
+                mWinPiles[taker].push_back(card);
+                taker = (taker + 1) % NPlayers;
+            }
+            mPutDown[player].clear();
+        }
+    }
+    else
+    {
+        std::size_t turnWinner = 0;
+        while (!(contenders >> turnWinner & 1))
+            turnWinner++;
+        for (auto& pile : mPutDown)
+        {
+            for (const auto& card : pile)
+                mWinPiles[turnWinner].push_back(card);
+            pile.clear();
+        }
+    }
+
+    // Eliminate the players left with no cards
+    for (std::size_t player = 0; player < NPlayers; player++)
+    {
+        if ((mActive >> player & 1) && mDecks[player].empty() && mWinPiles[player].empty())
+        {
+            mActive &= ~(PlayerMask(1) << player);
+            mEliminatedOnTurn[player] = mTurnCounter;
+        }
+    }
+
+    if (mTurnCap != 0 && mTurnCounter >= mTurnCap && !gameOver())
+        mCapped = true;
+}
+
+template<std::size_t NPlayers>
+void WarGame<NPlayers>::autoPlay()
+{
+    while (!gameOver())
+        playTurn();
+}
+
+template<std::size_t NPlayers>
+int WarGame<NPlayers>::winner() const
+{
+    if (mActive == 0 || mActive != (mActive & -mActive))
+        return 0;
+    int player = 1;
+    while (!(mActive >> (player - 1) & 1))
+        player++;
+    return player;
+}
+
+template<std::size_t NPlayers>
+int WarGame<NPlayers>::playersLeft() const
+{
+    int count = 0;
+    for (std::size_t player = 0; player < NPlayers; player++)
+        count += mActive >> player & 1;
+    return count;
+}
+
+template<std::size_t NPlayers>
+std::size_t WarGame<NPlayers>::cardCount(int player) const
+{
+    return mDecks[player - 1].size() + mWinPiles[player - 1].size();
+}
+
+template<std::size_t NPlayers>
+bool WarGame<NPlayers>::putDown(std::size_t player)
+{
+    PlayerDeck& deck = mDecks[player];
+    if (deck.empty())
+    {
+        if (mWinPiles[player].empty())
+            return false;
+        deck.shuffleIn(mWinPiles[player]);
+        mReshuffleCounter++;
+    }
+    mPutDown[player].push_back(deck.deal_card());
+    return true;
+}
+
+template<std::size_t NPlayers>
+void WarGame<NPlayers>::initialize(const std::vector<PlayingCard>& cards, Deck<CompactCard, Engine>& dealDeck)
+{
+    const std::size_t count = cards.size() - (cards.size() % NPlayers); // cards must divide evenly
+    std::vector<CompactCard> compactCards;
+    compactCards.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+        compactCards.push_back(CompactCard(cards[i]));
+    dealDeck.assign(std::move(compactCards));
+    dealDeck.shuffle();
+
+    // max any pile will ever be is total amount of cards
+    for (std::size_t player = 0; player < NPlayers; player++)
+    {
+        mDecks[player].reserve(count);
+        mWinPiles[player].reserve(count);
+        mPutDown[player].reserve(count);
+    }
+
+    while (!dealDeck.empty())
+    {
+        for (auto& pile : mWinPiles)
+            pile.push_back(dealDeck.deal_card());
+    }
+
+    for (std::size_t player = 0; player < NPlayers; player++)
+    {
+        mDecks[player].shuffleIn(mWinPiles[player]);
+        if (!mDecks[player].empty())
+            mActive |= PlayerMask(1) << player;
+    }
+}
+
+} // namespace doc
+#endif
@@ -0,0 +1,219 @@
+/**
+ * @file war_simulator.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare WarSimulator class, that plays many silent games of War across a pool of worker threads
+ * and collects the results.
+ *
+ */
+
+#ifndef WAR_SIMULATOR_H
+#define WAR_SIMULATOR_H
+
+#include "instrumentation.h"
+#include "playing_card.h"
+#include "statistics.h"
+#include "war_card_game.h"
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @brief Result of a single simulated game of War
+ */
+struct WarGameResult
+{
+    unsigned long long turns = 0; /**<@brief Turns played */
+    unsigned long long wars = 0; /**<@brief Wars played */
+    unsigned long long reshuffles = 0; /**<@brief Win pile reshuffles performed */
+    unsigned long long longestWar = 0; /**<@brief Most consecutive wars played in one turn */
+    int winner = 0; /**<@brief 1 if Player One won, 2 if Player Two won, 0 if the game was stopped */
+    WarOutcome outcome = WarOutcome::InProgress; /**<@brief How the game ended */
+};
+
+/**
+ * @brief Results of a batch of simulated games of War
+ */
+struct WarSimulationResult
+{
+    std::vector<WarGameResult> games; /**<@brief Result of each game, indexed by game number */
+    unsigned long long totalTurns = 0; /**<@brief Sum of turns played over all games */
+    unsigned long long totalWars = 0; /**<@brief Sum of wars played over all games */
+    unsigned long long totalReshuffles = 0; /**<@brief Sum of reshuffles performed over all games */
+    unsigned long long playerOneWins = 0; /**<@brief Number of games won by Player One */
+    unsigned long long playerTwoWins = 0; /**<@brief Number of games won by Player Two */
+    unsigned long long cycles = 0; /**<@brief Number of games stopped because they cycled */
+    unsigned long long capped = 0; /**<@brief Number of games stopped at the turn cap */
+    InstrumentationCounters instrumentation; /**<@brief Work counted on every thread, with DOC_INSTRUMENTATION */
+};
+
+/**
+ * @class WarStats "war_simulator.h" "war_simulator.h"
+ * @brief Streaming summary of any number of simulated games of War, in fixed memory.
+ *
+ * Keeps the outcome counts, and a Distribution (mean, variance, power of two histogram and approximate
+ * quantiles) of the turns, wars, longest war and reshuffles of each game, without keeping the games. Summaries
+ * of separate batches of games merge into the summary of all of them.
+ */
+class WarStats
+{
+    public:
+
+        /**
+         * @brief Add a game to the summary
+         */
+        void add(const WarGameResult& game);
+
+        /**
+         * @brief Add every game summarized by another WarStats
+         */
+        void merge(const WarStats& other);
+
+        /**
+         * @brief Write the summary as CSV, with one metric,statistic,value row per statistic
+         */
+        void writeCsv(std::ostream& out) const;
+
+        /**
+         * @brief Write the summary as a JSON object
+         */
+        void writeJson(std::ostream& out) const;
+
+        /** @brief Returns the number of games summarized */
+        unsigned long long games() const { return mTurns.stats().count(); }
+
+        /** @brief Returns the number of games won by Player One */
+        unsigned long long playerOneWins() const { return mPlayerOneWins; }
+
+        /** @brief Returns the number of games won by Player Two */
+        unsigned long long playerTwoWins() const { return mPlayerTwoWins; }
+
+        /** @brief Returns the number of games stopped because they cycled */
+        unsigned long long cycles() const { return mCycles; }
+
+        /** @brief Returns the number of games stopped at the turn cap */
+        unsigned long long capped() const { return mCapped; }
+
+        /** @brief Returns the distribution of turns played per game */
+        const Distribution& turns() const { return mTurns; }
+
+        /** @brief Returns the distribution of wars played per game */
+        const Distribution& wars() const { return mWars; }
+
+        /** @brief Returns the distribution of the most consecutive wars in one turn of each game */
+        const Distribution& longestWar() const { return mLongestWar; }
+
+        /** @brief Returns the distribution of reshuffles per game */
+        const Distribution& reshuffles() const { return mReshuffles; }
+
+    private:
+
+        unsigned long long mPlayerOneWins = 0; /**<@brief Number of games won by Player One */
+        unsigned long long mPlayerTwoWins = 0; /**<@brief Number of games won by Player Two */
+        unsigned long long mCycles = 0; /**<@brief Number of games stopped because they cycled */
+        unsigned long long mCapped = 0; /**<@brief Number of games stopped at the turn cap */
+        Distribution mTurns; /**<@brief Turns played per game */
+        Distribution mWars; /**<@brief Wars played per game */
+        Distribution mLongestWar; /**<@brief Most consecutive wars in one turn of each game */
+        Distribution mReshuffles; /**<@brief Reshuffles per game */
+
+};
+
+/**
+ * @class WarSimulator "war_simulator.h" "war_simulator.h"
+ * @brief Plays batches of SilentWarCardGame games, spread over the worker threads of a ThreadPool.
+ *
+ * Every game is seeded from the master seed and its game number, never from the thread that plays it, so a
+ * batch produces the same results for the same master seed whatever the number of threads. Each game owns
+ * its own decks and random number generators, so workers share no state while playing. Each worker allocates
+ * its games' decks and piles from its own monotonic arena, released after every chunk of games.
+ */
+class WarSimulator
+{
+    public:
+
+        /**
+         * @brief Construct simulator that plays standard 52 card games
+         */
+        WarSimulator();
+
+        /**
+         * @brief Construct simulator that plays games with a custom assortment of playing cards
+         * @param[in] cards Cards to deal to players in each game (see WarCardGame)
+         */
+        WarSimulator(const std::vector<PlayingCard>& cards);
+
+        /**
+         * @brief Play a batch of games and return their results
+         *
+         * @param[in] numGames Number of games to play
+         * @param[in] threads Number of worker threads to use. 0 uses one thread per hardware thread.
+         * @param[in] masterSeed Seed that all of the games' seeds are derived from
+         * @return Results of each game, and totals over all of the games
+         */
+        WarSimulationResult run(unsigned long long numGames, unsigned int threads, std::uint64_t masterSeed) const;
+
+        /**
+         * @brief Play a batch of games and return only their summary, so no memory is kept per game
+         *
+         * Each worker thread summarizes the games it plays into its own WarStats, and these are merged once
+         * the workers finish. The counts, histograms and quantiles do not depend on the number of threads, and
+         * the means and variances only up to rounding.
+         * @param[in] numGames Number of games to play
+         * @param[in] threads Number of worker threads to use. 0 uses one thread per hardware thread.
+         * @param[in] masterSeed Seed that all of the games' seeds are derived from
+         * @return Summary of the games
+         */
+        WarStats summarize(unsigned long long numGames, unsigned int threads, std::uint64_t masterSeed) const;
+
+        /**
+         * @brief Play a single silent game to completion
+         *
+         * @param[in] gameSeed Seed for the game's random number generators
+         * @param[in] resource Memory resource the game's decks and piles allocate from
+         * @return Result of the game
+         */
+        WarGameResult playGame(std::uint64_t gameSeed,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+        /**
+         * @brief Returns the seed used for a game within a batch
+         *
+         * @param[in] masterSeed Seed of the batch
+         * @param[in] gameIndex Number of the game within the batch
+         * @return Seed of the game
+         */
+        static std::uint64_t gameSeed(std::uint64_t masterSeed, unsigned long long gameIndex);
+
+        /**
+         * @brief Set what players do with their win pile in each game (see WarCardGame::setWinPileRule)
+         * @param[in] rule Win pile rule. The default is WinPileRule::Shuffle.
+         */
+        void setWinPileRule(WinPileRule rule) { mWinPileRule = rule; }
+
+        /**
+         * @brief Set the number of turns after which each game is stopped
+         * @param[in] cap Turn cap. 0, the default, is no cap.
+         */
+        void setTurnCap(unsigned long long cap) { mTurnCap = cap; }
+
+    private:
+
+        std::vector<PlayingCard> mCards; /**<@brief Cards dealt out in each game */
+        WinPileRule mWinPileRule = WinPileRule::Shuffle; /**<@brief What players do with their win piles */
+        unsigned long long mTurnCap = 0; /**<@brief Turns after which each game is stopped, 0 for no cap */
+
+};
+
+} // namespace doc
+#endif
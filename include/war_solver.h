@@ -0,0 +1,115 @@
+/**
+ * @file war_solver.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare WarSolver class, that computes the exact winner and game length probabilities of War for a
+ * small deck.
+ */
+
+#ifndef WAR_SOLVER_H
+#define WAR_SOLVER_H
+
+#include "playing_card.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief "Deck of Cards" namespace
+ */
+namespace doc
+{
+
+/**
+ * @brief Exact probabilities of the outcomes of a game of War
+ */
+struct WarDistribution
+{
+    std::vector<double> gameLength; /**<@brief gameLength[t] is the probability the game ends after t turns */
+    double playerOneWins = 0.0; /**<@brief Probability Player One wins */
+    double playerTwoWins = 0.0; /**<@brief Probability Player Two wins */
+    double unresolved = 0.0; /**<@brief Probability the game is still being played when solving stopped */
+    unsigned long long states = 0; /**<@brief Number of distinct positions reached */
+
+    /**
+     * @brief Returns the mean game length of the games that ended
+     */
+    double meanLength() const;
+};
+
+/**
+ * @class WarSolver "war_solver.h" "war_solver.h"
+ * @brief Computes the exact distribution of the winner and game length of a SilentWarCardGame played with a
+ * small deck, as ground truth for the simulators.
+ *
+ * With WinPileRule::Shuffle, every deck is a uniform shuffle of the win pile it came from, so dealing from it
+ * draws uniformly from the cards left in it, and the order of a win pile never matters. A position is
+ * therefore just how many cards of each War strength are in each player's deck and win pile, which also merges
+ * positions that differ only by suit. Each position is encoded as a single integer.
+ *
+ * Solving propagates the probability of every position forward one turn at a time, adding the probability of
+ * games that end to their winner and length. The outcomes of a turn from each position, with their
+ * probabilities, are worked out once following WarCardGame's rules exactly, and kept in a transposition table
+ * that is reused across turns and calls to solve(). The table numbers positions as they are found, so each turn
+ * propagates probabilities between arrays rather than hash tables.
+ */
+class WarSolver
+{
+    public:
+
+        /**
+         * @brief Construct solver for the games WarCardGame(cards) plays
+         * @param[in] cards Cards dealt to the players. The last card is dropped if there are an odd number.
+         * @throws std::invalid_argument if there are fewer than 2 cards, or too many to encode a position in
+         * 64 bits (around 20 cards, depending on how many share a strength)
+         */
+        explicit WarSolver(const std::vector<PlayingCard>& cards);
+
+        /**
+         * @brief Computes the probability of each outcome
+         * @param[in] maxTurns Turns after which to stop, leaving the rest of the probability unresolved
+         * @param[in] tolerance Probability of the games still being played below which to stop early
+         * @return Winner and game length probabilities
+         */
+        WarDistribution solve(unsigned long long maxTurns = 100000, double tolerance = 1e-12);
+
+        /** @brief Returns the number of cards in play */
+        unsigned int cardCount() const { return mCardCount; }
+
+    private:
+
+        /**
+         * @brief One outcome of a turn
+         */
+        struct Transition
+        {
+            std::uint64_t position; /**<@brief Encoded position after the turn, or its number once found */
+            double probability; /**<@brief Probability of the outcome */
+            int winner; /**<@brief Winner of the game after the turn, or 0 if it goes on */
+        };
+
+        /**
+         * @brief Returns the number of a position, numbering it if it has not been found before
+         */
+        std::uint32_t positionNumber(std::uint64_t position);
+
+        /**
+         * @brief Returns the outcomes of a turn played from a numbered position, working them out the first time
+         */
+        const std::vector<Transition>& transitions(std::uint32_t number);
+
+        std::array<std::uint8_t, 13> mTotals{}; /**<@brief Number of cards of each War strength, 2 to Ace */
+        unsigned int mCardCount = 0; /**<@brief Number of cards in play */
+        std::unordered_map<std::uint64_t, std::uint32_t> mNumbers; /**<@brief Number of each position found */
+        std::vector<std::uint64_t> mPositions; /**<@brief Encoded position of each number */
+        std::vector<std::vector<Transition>> mTransitions; /**<@brief Outcomes of a turn from each number */
+        std::vector<bool> mExpanded; /**<@brief If a number's outcomes have been worked out */
+
+};
+
+} // namespace doc
+#endif
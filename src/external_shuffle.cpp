@@ -0,0 +1,160 @@
+/*
+ * @file external_shuffle.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define BinaryFile class, the files read and written by externalShuffle and FileDeck.
+ */
+
+#include "external_shuffle.h"
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace doc
+{
+
+namespace detail
+{
+
+namespace
+{
+
+[[noreturn]] void fail(const std::string& action, const std::string& name)
+{
+    throw std::system_error(errno, std::generic_category(), "BinaryFile: cannot " + action + " " + name);
+}
+
+} // namespace
+
+BinaryFile::~BinaryFile()
+{
+    close();
+}
+
+BinaryFile::BinaryFile(BinaryFile&& other) noexcept : mFd(other.mFd), mName(std::move(other.mName))
+{
+    other.mFd = -1;
+}
+
+BinaryFile& BinaryFile::operator=(BinaryFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        mFd = other.mFd;
+        mName = std::move(other.mName);
+        other.mFd = -1;
+    }
+    return *this;
+}
+
+BinaryFile BinaryFile::openRead(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        fail("open", path);
+#if defined(POSIX_FADV_SEQUENTIAL)
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    return BinaryFile(fd, path);
+}
+
+BinaryFile BinaryFile::create(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        fail("create", path);
+    return BinaryFile(fd, path);
+}
+
+BinaryFile BinaryFile::temporary(const std::string& directory)
+{
+    std::string pattern = directory + "/doc_shuffle_XXXXXX";
+    std::vector<char> name(pattern.begin(), pattern.end());
+    name.push_back('\0');
+    const int fd = ::mkstemp(name.data());
+    if (fd < 0)
+        fail("create a temporary file in", directory);
+    ::unlink(name.data());
+    return BinaryFile(fd, name.data());
+}
+
+std::uint64_t BinaryFile::size() const
+{
+    struct stat status;
+    if (::fstat(mFd, &status) != 0)
+        fail("read the size of", mName);
+    return static_cast<std::uint64_t>(status.st_size);
+}
+
+std::size_t BinaryFile::read(void* data, std::size_t bytes)
+{
+    char* out = static_cast<char*>(data);
+    std::size_t done = 0;
+    while (done < bytes)
+    {
+        const ssize_t result = ::read(mFd, out + done, bytes - done);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            fail("read", mName);
+        }
+        if (result == 0)
+            break;
+        done += static_cast<std::size_t>(result);
+    }
+    return done;
+}
+
+void BinaryFile::write(const void* data, std::size_t bytes)
+{
+    const char* in = static_cast<const char*>(data);
+    std::size_t done = 0;
+    while (done < bytes)
+    {
+        const ssize_t result = ::write(mFd, in + done, bytes - done);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            fail("write", mName);
+        }
+        done += static_cast<std::size_t>(result);
+    }
+}
+
+void BinaryFile::rewind()
+{
+    if (::lseek(mFd, 0, SEEK_SET) != 0)
+        fail("rewind", mName);
+}
+
+void BinaryFile::close()
+{
+    if (mFd >= 0)
+    {
+        ::close(mFd);
+        mFd = -1;
+    }
+}
+
+std::string directoryOf(const std::string& path)
+{
+    const std::size_t slash = path.rfind('/');
+    if (slash == std::string::npos)
+        return ".";
+    return slash == 0 ? "/" : path.substr(0, slash);
+}
+
+} // namespace detail
+
+} // namespace doc
@@ -0,0 +1,104 @@
+/*
+ * @file instrumentation.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define the replacement operator new and delete that count allocations, when DOC_INSTRUMENTATION is
+ * defined. Link this file into a program to count its allocations.
+ */
+
+#include "instrumentation.h"
+
+#ifdef DOC_INSTRUMENTATION
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+void* countedAllocate(std::size_t size)
+{
+    DOC_COUNT(allocations, 1);
+    DOC_COUNT(allocatedBytes, size);
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* countedAllocate(std::size_t size, std::align_val_t alignment)
+{
+    DOC_COUNT(allocations, 1);
+    DOC_COUNT(allocatedBytes, size);
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    const std::size_t rounded = (size + align - 1) / align * align; // aligned_alloc needs a multiple
+    if (void* memory = std::aligned_alloc(align, rounded == 0 ? align : rounded))
+        return memory;
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return countedAllocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return countedAllocate(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+#endif
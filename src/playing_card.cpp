@@ -10,9 +10,8 @@
  */
 
 #include "playing_card.h"
-#include <vector>
-#include <sstream>
 #include <type_traits>
+#include <vector>
 
 namespace doc
 {
@@ -20,55 +19,13 @@ namespace doc
 // static
 std::string PlayingCard::toString(const Suite suite)
 {
-    switch (suite)
-    {
-        case Suite::Clubs:
-            return "Clubs";
-        case Suite::Diamonds:
-            return "Diamonds";
-        case Suite::Hearts:
-            return "Hearts";
-        case Suite::Spades:
-            return "Spades";
-        default:
-            return "";
-    }
+    return std::string(name(suite));
 }
 
 // static
 std::string PlayingCard::toString(const Rank rank)
 {
-    switch (rank)
-    {
-        case Rank::Ace:
-            return "A";
-        case Rank::Two:
-            return "2";
-        case Rank::Three:
-            return "3";
-        case Rank::Four:
-            return "4";
-        case Rank::Five:
-            return "5";
-        case Rank::Six:
-            return "6";
-        case Rank::Seven:
-            return "7";
-        case Rank::Eight:
-            return "8";
-        case Rank::Nine:
-            return "9";
-        case Rank::Ten:
-            return "10";
-        case Rank::Jack:
-            return "J";
-        case Rank::Queen:
-            return "Q";
-        case Rank::King:
-            return "K";
-        default:
-            return "";
-    }
+    return std::string(name(rank));
 }
 
 // static
@@ -77,25 +34,10 @@ int PlayingCard::toInt(const Rank rank)
     return static_cast<std::underlying_type<Rank>::type>(rank);
 }
 
-PlayingCard::PlayingCard(const Suite suite, const Rank rank) : mSuite(suite), mRank(rank)
-{
-}
-
-PlayingCard::Suite PlayingCard::suite() const
-{
-    return mSuite;
-}
-
-PlayingCard::Rank PlayingCard::rank() const
-{
-    return mRank;
-}
-
 std::string PlayingCard::str() const
 {
-    std::stringstream outbuffer;
-    outbuffer << PlayingCard::toString(mRank) << " " << PlayingCard::toString(mSuite);
-    return outbuffer.str();
+    char buffer[kMaxFormattedLength];
+    return std::string(buffer, formatTo(buffer));
 }
 
 std::vector<PlayingCard> buildStandardDeck()
@@ -0,0 +1,195 @@
+/*
+ * @file statistics.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define streaming statistics accumulators, that summarize any number of values in fixed memory and
+ * can be merged.
+ */
+
+#include "statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace doc
+{
+
+namespace
+{
+
+/** @brief Values below this are counted as zero by QuantileSketch, since log(value) is unbounded near 0 */
+const double kMinSketchValue = 1e-9;
+
+} // namespace
+
+void RunningStats::add(double value)
+{
+    if (mCount == 0)
+    {
+        mMin = value;
+        mMax = value;
+    }
+    else
+    {
+        mMin = std::min(mMin, value);
+        mMax = std::max(mMax, value);
+    }
+    mCount++;
+    const double delta = value - mMean;
+    mMean += delta / mCount;
+    mM2 += delta * (value - mMean);
+}
+
+void RunningStats::merge(const RunningStats& other)
+{
+    if (other.mCount == 0)
+        return;
+    if (mCount == 0)
+    {
+        *this = other;
+        return;
+    }
+    const double count = static_cast<double>(mCount + other.mCount);
+    const double delta = other.mMean - mMean;
+    mMean += delta * other.mCount / count;
+    mM2 += other.mM2 + delta * delta * (static_cast<double>(mCount) * other.mCount / count);
+    mCount += other.mCount;
+    mMin = std::min(mMin, other.mMin);
+    mMax = std::max(mMax, other.mMax);
+}
+
+double RunningStats::variance() const
+{
+    return mCount < 2 ? 0.0 : mM2 / (mCount - 1);
+}
+
+double RunningStats::stddev() const
+{
+    return std::sqrt(variance());
+}
+
+void LogHistogram::merge(const LogHistogram& other)
+{
+    for (int bucket = 0; bucket < kBuckets; bucket++)
+        mCounts[bucket] += other.mCounts[bucket];
+}
+
+unsigned long long LogHistogram::total() const
+{
+    unsigned long long sum = 0;
+    for (const auto count : mCounts)
+        sum += count;
+    return sum;
+}
+
+// static
+int LogHistogram::bucketOf(std::uint64_t value)
+{
+    int bucket = 0;
+    while (value != 0)
+    {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// static
+std::uint64_t LogHistogram::bucketMin(int bucket)
+{
+    return bucket == 0 ? 0 : std::uint64_t(1) << (bucket - 1);
+}
+
+// static
+std::uint64_t LogHistogram::bucketMax(int bucket)
+{
+    return bucket == 0 ? 0 : bucketMin(bucket) + (bucketMin(bucket) - 1);
+}
+
+QuantileSketch::QuantileSketch(double relativeAccuracy) : mRelativeAccuracy(relativeAccuracy)
+{
+    if (!(relativeAccuracy > 0.0 && relativeAccuracy < 1.0))
+        throw std::invalid_argument("QuantileSketch: relative accuracy must be between 0 and 1");
+    mGamma = (1.0 + relativeAccuracy) / (1.0 - relativeAccuracy);
+    mLogGamma = std::log(mGamma);
+}
+
+void QuantileSketch::add(double value)
+{
+    if (value < 0.0)
+        throw std::invalid_argument("QuantileSketch: values must not be negative");
+    mCount++;
+    if (value < kMinSketchValue)
+        mZeroCount++;
+    else
+        bin(static_cast<int>(std::ceil(std::log(value) / mLogGamma)))++;
+}
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    if (other.mRelativeAccuracy != mRelativeAccuracy)
+        throw std::invalid_argument("QuantileSketch: cannot merge sketches with different accuracies");
+    for (std::size_t i = 0; i < other.mBins.size(); i++)
+    {
+        if (other.mBins[i] != 0)
+            bin(other.mFirstIndex + static_cast<int>(i)) += other.mBins[i];
+    }
+    mZeroCount += other.mZeroCount;
+    mCount += other.mCount;
+}
+
+double QuantileSketch::quantile(double q) const
+{
+    if (mCount == 0)
+        return 0.0;
+    q = std::min(1.0, std::max(0.0, q));
+    const unsigned long long rank = static_cast<unsigned long long>(q * (mCount - 1));
+    unsigned long long seen = mZeroCount;
+    if (rank < seen)
+        return 0.0;
+    for (std::size_t i = 0; i < mBins.size(); i++)
+    {
+        seen += mBins[i];
+        if (rank < seen)
+            return 2.0 * std::pow(mGamma, mFirstIndex + static_cast<int>(i)) / (mGamma + 1.0);
+    }
+    return 2.0 * std::pow(mGamma, mFirstIndex + static_cast<int>(mBins.size()) - 1) / (mGamma + 1.0);
+}
+
+unsigned long long& QuantileSketch::bin(int index)
+{
+    if (mBins.empty())
+    {
+        mFirstIndex = index;
+        mBins.push_back(0);
+    }
+    else if (index < mFirstIndex)
+    {
+        mBins.insert(mBins.begin(), mFirstIndex - index, 0);
+        mFirstIndex = index;
+    }
+    else if (index >= mFirstIndex + static_cast<int>(mBins.size()))
+    {
+        mBins.resize(index - mFirstIndex + 1, 0);
+    }
+    return mBins[index - mFirstIndex];
+}
+
+void Distribution::add(std::uint64_t value)
+{
+    mStats.add(static_cast<double>(value));
+    mHistogram.add(value);
+    mQuantiles.add(static_cast<double>(value));
+}
+
+void Distribution::merge(const Distribution& other)
+{
+    mStats.merge(other.mStats);
+    mHistogram.merge(other.mHistogram);
+    mQuantiles.merge(other.mQuantiles);
+}
+
+} // namespace doc
@@ -0,0 +1,312 @@
+/*
+ * @file trace_writer.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define TraceWriter class, that writes text formatted on many threads to a file from a background
+ * thread, and TraceWarSink, an event sink that traces a game of War through it.
+ */
+
+#include "trace_writer.h"
+#include <cerrno>
+#include <charconv>
+#include <fcntl.h>
+#include <stdexcept>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace doc
+{
+
+namespace
+{
+
+/** @brief Most bytes of any line TraceWarSink writes */
+const std::size_t kMaxLineBytes = 160;
+
+/** @brief Most written buffers kept to be recycled */
+const std::size_t kMaxFreeBuffers = 64;
+
+/**
+ * @brief Builds one line of text in space claimed from a channel
+ */
+class Line
+{
+    public:
+        explicit Line(TraceWriter::Channel& channel) :
+            mChannel(channel), mStart(channel.claim(kMaxLineBytes)), mEnd(mStart) {}
+
+        ~Line() { mChannel.commit(static_cast<std::size_t>(mEnd - mStart)); }
+
+        Line& operator<<(std::string_view text)
+        {
+            for (const char character : text)
+                *mEnd++ = character;
+            return *this;
+        }
+
+        Line& operator<<(unsigned long long value)
+        {
+            mEnd = std::to_chars(mEnd, mStart + kMaxLineBytes, value).ptr;
+            return *this;
+        }
+
+        Line& operator<<(const PlayingCard& card)
+        {
+            mEnd += card.formatTo(mEnd);
+            return *this;
+        }
+
+    private:
+        TraceWriter::Channel& mChannel; /**<@brief Channel the line is written to */
+        char* mStart; /**<@brief Start of the line */
+        char* mEnd; /**<@brief End of the line so far */
+};
+
+int openFile(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "TraceWriter: cannot open " + path);
+    return fd;
+}
+
+} // namespace
+
+TraceWriter::Channel::Channel(TraceWriter& writer) : mWriter(&writer)
+{
+}
+
+TraceWriter::Channel::~Channel()
+{
+    if (mWriter != nullptr)
+        flush();
+}
+
+TraceWriter::Channel::Channel(Channel&& other) noexcept :
+    mWriter(other.mWriter), mBuffer(std::move(other.mBuffer)), mUsed(other.mUsed)
+{
+    other.mWriter = nullptr;
+    other.mUsed = 0;
+}
+
+TraceWriter::Channel& TraceWriter::Channel::operator=(Channel&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (mWriter != nullptr)
+            flush();
+        mWriter = other.mWriter;
+        mBuffer = std::move(other.mBuffer);
+        mUsed = other.mUsed;
+        other.mWriter = nullptr;
+        other.mUsed = 0;
+    }
+    return *this;
+}
+
+char* TraceWriter::Channel::claim(std::size_t maxBytes)
+{
+    if (maxBytes > mWriter->bufferBytes())
+        throw std::length_error("TraceWriter::Channel: record is larger than a buffer");
+    if (mUsed + maxBytes > mBuffer.size())
+    {
+        flush();
+        mBuffer = mWriter->acquire();
+    }
+    return mBuffer.data() + mUsed;
+}
+
+void TraceWriter::Channel::append(std::string_view text)
+{
+    char* out = claim(text.size());
+    text.copy(out, text.size());
+    commit(text.size());
+}
+
+void TraceWriter::Channel::flush()
+{
+    if (mUsed == 0)
+        return;
+    mWriter->submit(std::move(mBuffer), mUsed);
+    mBuffer = std::vector<char>();
+    mUsed = 0;
+}
+
+TraceWriter::TraceWriter(int fd, std::size_t bufferBytes, std::size_t maxQueued) :
+    mFd(fd), mOwnsFd(false), mBufferBytes(bufferBytes), mMaxQueued(maxQueued == 0 ? 1 : maxQueued)
+{
+    if (bufferBytes == 0)
+        throw std::invalid_argument("TraceWriter: buffers must hold at least one byte");
+    mThread = std::thread(&TraceWriter::run, this);
+}
+
+TraceWriter::TraceWriter(const std::string& path, std::size_t bufferBytes, std::size_t maxQueued) :
+    TraceWriter(openFile(path), bufferBytes, maxQueued)
+{
+    mOwnsFd = true;
+}
+
+TraceWriter::~TraceWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mChanged.notify_all();
+    mThread.join();
+    if (mOwnsFd)
+        ::close(mFd);
+}
+
+void TraceWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mChanged.wait(lock, [this]() { return mQueue.empty() && !mWriting; });
+    if (mError != 0)
+        throw std::system_error(mError, std::generic_category(), "TraceWriter: write failed");
+}
+
+void TraceWriter::submit(std::vector<char>&& buffer, std::size_t used)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mChanged.wait(lock, [this]() { return mQueue.size() < mMaxQueued; });
+    mQueue.push_back(Pending{std::move(buffer), used});
+    lock.unlock();
+    mChanged.notify_all();
+}
+
+std::vector<char> TraceWriter::acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mFree.empty())
+        {
+            std::vector<char> buffer = std::move(mFree.back());
+            mFree.pop_back();
+            return buffer;
+        }
+    }
+    return std::vector<char>(mBufferBytes);
+}
+
+void TraceWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mChanged.wait(lock, [this]() { return !mQueue.empty() || mStopping; });
+        if (mQueue.empty())
+            break;
+        Pending pending = std::move(mQueue.front());
+        mQueue.pop_front();
+        mWriting = true;
+        lock.unlock();
+        mChanged.notify_all(); // a channel may be waiting for room in the queue
+
+        int error = 0;
+        std::size_t written = 0;
+        while (written < pending.used)
+        {
+            const ssize_t result = ::write(mFd, pending.buffer.data() + written, pending.used - written);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                error = errno;
+                break;
+            }
+            written += static_cast<std::size_t>(result);
+            mWrites.fetch_add(1, std::memory_order_relaxed);
+        }
+        mBytesWritten.fetch_add(written, std::memory_order_relaxed);
+
+        lock.lock();
+        if (error != 0 && mError == 0)
+            mError = error;
+        if (mFree.size() < kMaxFreeBuffers)
+            mFree.push_back(std::move(pending.buffer));
+        mWriting = false;
+        mChanged.notify_all();
+    }
+}
+
+TraceWarSink::TraceWarSink(TraceWriter& writer) : mChannel(writer)
+{
+}
+
+void TraceWarSink::cardsShown(const PlayingCard& card1, const PlayingCard& card2)
+{
+    Line(mChannel) << "Player 1 shows: " << card1 << "  Player 2 shows: " << card2 << "\n";
+}
+
+void TraceWarSink::warStarted()
+{
+    Line(mChannel) << "WAR!\n";
+}
+
+void TraceWarSink::playerOutOfCards(int player)
+{
+    Line(mChannel) << "Player " << static_cast<unsigned long long>(player) <<
+        " ran out of cards & could not continue the war\n";
+}
+
+void TraceWarSink::warWon(int player)
+{
+    Line(mChannel) << "Player " << static_cast<unsigned long long>(player) << " Won the War\n";
+}
+
+void TraceWarSink::warDrawn()
+{
+    Line(mChannel) << " The War was a Draw ... bummer ...\n";
+}
+
+void TraceWarSink::deckReplenished(int, std::size_t)
+{
+    // Not part of the printed game
+}
+
+void TraceWarSink::gameStarted(std::size_t p1Cards, std::size_t p2Cards)
+{
+    printScore(p1Cards, p2Cards);
+}
+
+void TraceWarSink::turnEnded(std::size_t p1Cards, std::size_t p2Cards)
+{
+    printScore(p1Cards, p2Cards);
+    Line(mChannel) << "\n";
+}
+
+void TraceWarSink::gameOver(int, unsigned long long turns)
+{
+    Line(mChannel) << turns << " turns were played\n";
+}
+
+void TraceWarSink::turnAfterGameOver()
+{
+    Line(mChannel) << "Cannot play turn, game has already ended.\n";
+}
+
+void TraceWarSink::gameStopped(WarOutcome outcome, unsigned long long turns)
+{
+    if (outcome == WarOutcome::Cycle)
+        Line(mChannel) << "Game stopped after " << turns << " turns, the cards are repeating a cycle.\n";
+    else
+        Line(mChannel) << "Game stopped after " << turns << " turns, the turn limit was reached.\n";
+}
+
+void TraceWarSink::printScore(std::size_t p1Cards, std::size_t p2Cards)
+{
+    Line line(mChannel);
+    line << "Player One has " << static_cast<unsigned long long>(p1Cards) << " cards left.   Player Two has " <<
+        static_cast<unsigned long long>(p2Cards) << " cards left.\n";
+    if (p1Cards == 0)
+        line << "Player Two has won!\n";
+    else if (p2Cards == 0)
+        line << "Player One has won!\n";
+}
+
+} // namespace doc
@@ -0,0 +1,101 @@
+/*
+ * @file war_event_sink.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define TextWarSink class, that prints a game of War's progress as text.
+ *
+ */
+
+#include "war_event_sink.h"
+#include <iostream>
+
+namespace doc
+{
+
+TextWarSink::TextWarSink() : mOut(&std::cout)
+{
+}
+
+TextWarSink::TextWarSink(std::ostream& out) : mOut(&out)
+{
+}
+
+void TextWarSink::cardsShown(const PlayingCard& card1, const PlayingCard& card2)
+{
+    char name1[PlayingCard::kMaxFormattedLength];
+    char name2[PlayingCard::kMaxFormattedLength];
+    *mOut << "Player 1 shows: ";
+    mOut->write(name1, card1.formatTo(name1));
+    *mOut << "  Player 2 shows: ";
+    mOut->write(name2, card2.formatTo(name2));
+    *mOut << "\n";
+}
+
+void TextWarSink::warStarted()
+{
+    *mOut << "WAR!\n";
+}
+
+void TextWarSink::playerOutOfCards(int player)
+{
+    *mOut << "Player " << player << " ran out of cards & could not continue the war\n";
+}
+
+void TextWarSink::warWon(int player)
+{
+    *mOut << "Player " << player << " Won the War\n";
+}
+
+void TextWarSink::warDrawn()
+{
+    *mOut << " The War was a Draw ... bummer ...\n";
+}
+
+void TextWarSink::deckReplenished(int, std::size_t)
+{
+    // Not part of the printed game
+}
+
+void TextWarSink::gameStarted(std::size_t p1Cards, std::size_t p2Cards)
+{
+    printScore(p1Cards, p2Cards);
+}
+
+void TextWarSink::turnEnded(std::size_t p1Cards, std::size_t p2Cards)
+{
+    printScore(p1Cards, p2Cards);
+    *mOut << "\n";
+}
+
+void TextWarSink::gameOver(int, unsigned long long turns)
+{
+    *mOut << turns << " turns were played\n";
+}
+
+void TextWarSink::turnAfterGameOver()
+{
+    *mOut << "Cannot play turn, game has already ended.\n";
+}
+
+void TextWarSink::gameStopped(WarOutcome outcome, unsigned long long turns)
+{
+    if (outcome == WarOutcome::Cycle)
+        *mOut << "Game stopped after " << turns << " turns, the cards are repeating a cycle.\n";
+    else
+        *mOut << "Game stopped after " << turns << " turns, the turn limit was reached.\n";
+}
+
+void TextWarSink::printScore(std::size_t p1Cards, std::size_t p2Cards)
+{
+    *mOut << "Player One has " << p1Cards << " cards left.   Player Two has " << p2Cards <<
+        " cards left.\n";
+    if (p1Cards == 0)
+        *mOut << "Player Two has won!\n";
+    else if (p2Cards == 0)
+        *mOut << "Player One has won!\n";
+}
+
+} // namespace doc
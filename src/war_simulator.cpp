@@ -0,0 +1,281 @@
+/*
+ * @file war_simulator.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define WarSimulator class, that plays many silent games of War across a pool of worker threads
+ * and collects the results.
+ *
+ */
+
+#include "war_simulator.h"
+#include "seed_stream.h"
+#include "thread_pool.h"
+#include "war_card_game.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace doc
+{
+
+namespace
+{
+
+/** @brief Number of games a worker claims at a time */
+const unsigned long long kGamesPerChunk = 64;
+
+/** @brief Size of each worker's arena, enough for a chunk of standard games without going to the heap */
+const std::size_t kArenaBytes = 128 * 1024;
+
+/** @brief Quantiles written by WarStats, with their names */
+const struct
+{
+    double q;
+    const char* name;
+} kQuantiles[] = {{0.5, "p50"}, {0.9, "p90"}, {0.99, "p99"}, {0.999, "p999"}};
+
+/**
+ * @brief Plays numGames games on a ThreadPool of threads. Workers claim chunks of games until none are left, and
+ * call play(worker, first, last, arena) for each chunk, where worker numbers the worker from 0 to threads - 1.
+ *
+ * Each worker's games allocate from its own monotonic arena, which is released after every chunk, so playing
+ * a batch takes no locks in the heap and reuses the same memory for every chunk.
+ */
+template <class Play>
+void runWorkers(unsigned long long numGames, unsigned int threads, Play play)
+{
+    std::atomic<unsigned long long> nextChunk(0);
+    auto worker = [&](unsigned int index)
+    {
+        std::vector<std::byte> buffer(kArenaBytes);
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        while (true)
+        {
+            const unsigned long long first = nextChunk.fetch_add(kGamesPerChunk);
+            if (first >= numGames)
+                break;
+            play(index, first, std::min(numGames, first + kGamesPerChunk), &arena);
+            arena.release();
+        }
+    };
+
+    // One task per worker, and the calling thread works too. A thread that finishes its worker has no chunks
+    // left, so any other worker it runs returns at once.
+    ThreadPool pool(threads);
+    pool.run(threads, [&](std::size_t index) { worker(static_cast<unsigned int>(index)); });
+}
+
+void writeCsvRows(std::ostream& out, const char* metric, const Distribution& distribution)
+{
+    const RunningStats& stats = distribution.stats();
+    out << metric << ",count," << stats.count() << "\n";
+    out << metric << ",mean," << stats.mean() << "\n";
+    out << metric << ",stddev," << stats.stddev() << "\n";
+    out << metric << ",min," << stats.min() << "\n";
+    out << metric << ",max," << stats.max() << "\n";
+    for (const auto& quantile : kQuantiles)
+        out << metric << "," << quantile.name << "," << distribution.quantiles().quantile(quantile.q) << "\n";
+    const LogHistogram& histogram = distribution.histogram();
+    for (int bucket = 0; bucket < LogHistogram::kBuckets; bucket++)
+    {
+        if (histogram.count(bucket) != 0)
+        {
+            out << metric << ",bucket_" << LogHistogram::bucketMin(bucket) << "_" <<
+                LogHistogram::bucketMax(bucket) << "," << histogram.count(bucket) << "\n";
+        }
+    }
+}
+
+void writeJsonObject(std::ostream& out, const Distribution& distribution)
+{
+    const RunningStats& stats = distribution.stats();
+    out << "{\"count\": " << stats.count() << ", \"mean\": " << stats.mean() << ", \"stddev\": " <<
+        stats.stddev() << ", \"min\": " << stats.min() << ", \"max\": " << stats.max();
+    for (const auto& quantile : kQuantiles)
+        out << ", \"" << quantile.name << "\": " << distribution.quantiles().quantile(quantile.q);
+    out << ", \"histogram\": [";
+    const LogHistogram& histogram = distribution.histogram();
+    bool first = true;
+    for (int bucket = 0; bucket < LogHistogram::kBuckets; bucket++)
+    {
+        if (histogram.count(bucket) != 0)
+        {
+            out << (first ? "" : ", ") << "{\"min\": " << LogHistogram::bucketMin(bucket) << ", \"max\": " <<
+                LogHistogram::bucketMax(bucket) << ", \"count\": " << histogram.count(bucket) << "}";
+            first = false;
+        }
+    }
+    out << "]}";
+}
+
+/**
+ * @brief A worker's WarStats, on its own cache lines so workers do not slow each other down
+ */
+struct alignas(64) WorkerStats
+{
+    WarStats stats;
+};
+
+} // namespace
+
+void WarStats::add(const WarGameResult& game)
+{
+    if (game.winner == 1)
+        mPlayerOneWins++;
+    else if (game.winner == 2)
+        mPlayerTwoWins++;
+    else if (game.outcome == WarOutcome::Cycle)
+        mCycles++;
+    else if (game.outcome == WarOutcome::Capped)
+        mCapped++;
+    mTurns.add(game.turns);
+    mWars.add(game.wars);
+    mLongestWar.add(game.longestWar);
+    mReshuffles.add(game.reshuffles);
+}
+
+void WarStats::merge(const WarStats& other)
+{
+    mPlayerOneWins += other.mPlayerOneWins;
+    mPlayerTwoWins += other.mPlayerTwoWins;
+    mCycles += other.mCycles;
+    mCapped += other.mCapped;
+    mTurns.merge(other.mTurns);
+    mWars.merge(other.mWars);
+    mLongestWar.merge(other.mLongestWar);
+    mReshuffles.merge(other.mReshuffles);
+}
+
+void WarStats::writeCsv(std::ostream& out) const
+{
+    out << "metric,statistic,value\n";
+    out << "games,count," << games() << "\n";
+    out << "games,player_one_wins," << mPlayerOneWins << "\n";
+    out << "games,player_two_wins," << mPlayerTwoWins << "\n";
+    out << "games,cycles," << mCycles << "\n";
+    out << "games,capped," << mCapped << "\n";
+    writeCsvRows(out, "turns", mTurns);
+    writeCsvRows(out, "wars", mWars);
+    writeCsvRows(out, "longest_war", mLongestWar);
+    writeCsvRows(out, "reshuffles", mReshuffles);
+}
+
+void WarStats::writeJson(std::ostream& out) const
+{
+    out << "{\"games\": " << games() << ", \"player_one_wins\": " << mPlayerOneWins <<
+        ", \"player_two_wins\": " << mPlayerTwoWins << ", \"cycles\": " << mCycles << ", \"capped\": " << mCapped;
+    out << ",\n \"turns\": ";
+    writeJsonObject(out, mTurns);
+    out << ",\n \"wars\": ";
+    writeJsonObject(out, mWars);
+    out << ",\n \"longest_war\": ";
+    writeJsonObject(out, mLongestWar);
+    out << ",\n \"reshuffles\": ";
+    writeJsonObject(out, mReshuffles);
+    out << "}\n";
+}
+
+WarSimulator::WarSimulator() : mCards(buildStandardDeck())
+{
+}
+
+WarSimulator::WarSimulator(const std::vector<PlayingCard>& cards) : mCards(cards)
+{
+}
+
+WarSimulationResult WarSimulator::run(unsigned long long numGames, unsigned int threads,
+        std::uint64_t masterSeed) const
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    WarSimulationResult result;
+    result.games.resize(numGames);
+
+    // Which worker plays a game does not affect its result, because each game is seeded from its game number
+    std::vector<InstrumentationCounters> workerCounters(threads);
+    runWorkers(numGames, threads, [&](unsigned int worker, unsigned long long first, unsigned long long last,
+            std::pmr::memory_resource* arena)
+    {
+        const InstrumentationCounters before = instrumentation::snapshot();
+        for (unsigned long long game = first; game < last; game++)
+            result.games[game] = playGame(gameSeed(masterSeed, game), arena);
+        workerCounters[worker] += instrumentation::snapshot() - before;
+    });
+    for (const auto& counters : workerCounters)
+        result.instrumentation += counters;
+
+    for (const auto& game : result.games)
+    {
+        result.totalTurns += game.turns;
+        result.totalWars += game.wars;
+        result.totalReshuffles += game.reshuffles;
+        if (game.winner == 1)
+            result.playerOneWins++;
+        else if (game.winner == 2)
+            result.playerTwoWins++;
+        else if (game.outcome == WarOutcome::Cycle)
+            result.cycles++;
+        else if (game.outcome == WarOutcome::Capped)
+            result.capped++;
+    }
+
+    return result;
+}
+
+WarStats WarSimulator::summarize(unsigned long long numGames, unsigned int threads, std::uint64_t masterSeed) const
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Each worker only touches its own summary, and the summaries are merged after the workers are joined
+    std::vector<WorkerStats> workerStats(threads);
+    runWorkers(numGames, threads, [&](unsigned int worker, unsigned long long first, unsigned long long last,
+            std::pmr::memory_resource* arena)
+    {
+        for (unsigned long long game = first; game < last; game++)
+            workerStats[worker].stats.add(playGame(gameSeed(masterSeed, game), arena));
+    });
+
+    WarStats stats;
+    for (const auto& worker : workerStats)
+        stats.merge(worker.stats);
+    return stats;
+}
+
+WarGameResult WarSimulator::playGame(std::uint64_t gameSeed, std::pmr::memory_resource* resource) const
+{
+    SilentWarCardGame game(mCards, gameSeed, resource);
+    game.setWinPileRule(mWinPileRule);
+    game.setTurnCap(mTurnCap);
+    WarGameResult result;
+    while (!game.gameOver())
+    {
+        const unsigned long long warsBefore = game.warsPlayed();
+        game.playTurn();
+        result.longestWar = std::max(result.longestWar, game.warsPlayed() - warsBefore);
+    }
+
+    result.turns = game.turnsPlayed();
+    result.wars = game.warsPlayed();
+    result.reshuffles = game.reshuffles();
+    result.winner = game.winner();
+    result.outcome = game.outcome();
+    return result;
+}
+
+// static
+std::uint64_t WarSimulator::gameSeed(std::uint64_t masterSeed, unsigned long long gameIndex)
+{
+    // Game seeds are the master seed's stream, which can jump straight to any game
+    return SeedStream(masterSeed).at(gameIndex);
+}
+
+} // namespace doc
@@ -0,0 +1,384 @@
+/*
+ * @file war_solver.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Define WarSolver class, that computes the exact winner and game length probabilities of War for a
+ * small deck.
+ */
+
+#include "war_solver.h"
+#include "compact_card.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace doc
+{
+
+namespace
+{
+
+const int kStrengths = 13; /**<@brief Number of War strengths, 2 to 14 */
+
+/** @brief Piles of a position during a turn. Between turns the pots are empty. */
+enum Pile { kP1Deck, kP1Win, kP2Deck, kP2Win, kP1Pot, kP2Pot, kPiles };
+
+/**
+ * @brief Number of cards of each strength (index 0 for 2, up to 12 for Ace) in each pile
+ */
+using Position = std::array<std::array<std::uint8_t, kStrengths>, kPiles>;
+using Totals = std::array<std::uint8_t, kStrengths>;
+
+int pileSize(const Position& position, int pile)
+{
+    int size = 0;
+    for (const auto count : position[pile])
+        size += count;
+    return size;
+}
+
+void moveAll(Position& position, int from, int to)
+{
+    for (int strength = 0; strength < kStrengths; strength++)
+    {
+        position[to][strength] += position[from][strength];
+        position[from][strength] = 0;
+    }
+}
+
+/**
+ * @brief Encodes the cards of each strength in Player One's deck and win pile and Player Two's deck, each
+ * 0 to total, as a mixed radix number. Player Two's win pile holds the rest.
+ */
+std::uint64_t encode(const Position& position, const Totals& totals)
+{
+    std::uint64_t key = 0;
+    for (int strength = 0; strength < kStrengths; strength++)
+    {
+        if (totals[strength] == 0)
+            continue;
+        const std::uint64_t radix = totals[strength] + 1u;
+        key = key * radix + position[kP1Deck][strength];
+        key = key * radix + position[kP1Win][strength];
+        key = key * radix + position[kP2Deck][strength];
+    }
+    return key;
+}
+
+Position decode(std::uint64_t key, const Totals& totals)
+{
+    Position position{};
+    for (int strength = kStrengths - 1; strength >= 0; strength--)
+    {
+        if (totals[strength] == 0)
+            continue;
+        const std::uint64_t radix = totals[strength] + 1u;
+        position[kP2Deck][strength] = static_cast<std::uint8_t>(key % radix);
+        key /= radix;
+        position[kP1Win][strength] = static_cast<std::uint8_t>(key % radix);
+        key /= radix;
+        position[kP1Deck][strength] = static_cast<std::uint8_t>(key % radix);
+        key /= radix;
+        position[kP2Win][strength] = totals[strength] - position[kP1Deck][strength] - position[kP1Win][strength] -
+            position[kP2Deck][strength];
+    }
+    return position;
+}
+
+/**
+ * @brief Works out every outcome of a turn, following BasicWarCardGame::playTurn() and war()
+ */
+template <class Transition>
+class TurnExpander
+{
+    public:
+
+        TurnExpander(const Totals& totals, std::vector<Transition>& outcomes) :
+            mTotals(totals), mOutcomes(outcomes) {}
+
+        void turn(Position position, double probability)
+        {
+            replenish(position);
+            dealBoth(position, probability, [&](Position& next, int card1, int card2, double outcome)
+            {
+                if (card1 == card2)
+                    war(next, outcome);
+                else
+                    settle(next, card1 > card2 ? 1 : 2, outcome);
+            });
+        }
+
+    private:
+
+        void war(Position position, double probability)
+        {
+            replenish(position);
+            if (outOfCards(position, probability))
+                return;
+            dealBoth(position, probability, [&](Position& faceDown, int, int, double afterFaceDown)
+            {
+                // No replenishing between the face down and face up cards
+                if (outOfCards(faceDown, afterFaceDown))
+                    return;
+                dealBoth(faceDown, afterFaceDown, [&](Position& faceUp, int card1, int card2, double outcome)
+                {
+                    if (card1 == card2)
+                        war(faceUp, outcome);
+                    else
+                        settle(faceUp, card1 > card2 ? 1 : 2, outcome);
+                });
+            });
+        }
+
+        /**
+         * @brief Calls next(position, card1, card2, probability) for every pair of strengths the players can
+         * deal, with the dealt cards moved to their pots
+         */
+        template <class Next>
+        void dealBoth(const Position& position, double probability, Next next)
+        {
+            const double size1 = pileSize(position, kP1Deck);
+            const double size2 = pileSize(position, kP2Deck);
+            for (int card1 = 0; card1 < kStrengths; card1++)
+            {
+                if (position[kP1Deck][card1] == 0)
+                    continue;
+                for (int card2 = 0; card2 < kStrengths; card2++)
+                {
+                    if (position[kP2Deck][card2] == 0)
+                        continue;
+                    Position dealt = position;
+                    dealt[kP1Deck][card1]--;
+                    dealt[kP1Pot][card1]++;
+                    dealt[kP2Deck][card2]--;
+                    dealt[kP2Pot][card2]++;
+                    next(dealt, card1, card2, probability * (position[kP1Deck][card1] / size1) *
+                            (position[kP2Deck][card2] / size2));
+                }
+            }
+        }
+
+        void replenish(Position& position)
+        {
+            if (pileSize(position, kP1Deck) == 0)
+                moveAll(position, kP1Win, kP1Deck);
+            if (pileSize(position, kP2Deck) == 0)
+                moveAll(position, kP2Win, kP2Deck);
+        }
+
+        /**
+         * @brief Ends the war if a player's deck is empty
+         * @return True if the war ended
+         */
+        bool outOfCards(Position& position, double probability)
+        {
+            const bool p1Out = pileSize(position, kP1Deck) == 0;
+            const bool p2Out = pileSize(position, kP2Deck) == 0;
+            if (p1Out && p2Out)
+                settle(position, 3, probability);
+            else if (p1Out)
+                settle(position, 2, probability);
+            else if (p2Out)
+                settle(position, 1, probability);
+            return p1Out || p2Out;
+        }
+
+        /**
+         * @brief Gives the pots to the turn's winner, or back to their players if it was a draw (3)
+         */
+        void settle(Position& position, int turnWinner, double probability)
+        {
+            moveAll(position, kP1Pot, turnWinner == 2 ? kP2Win : kP1Win);
+            moveAll(position, kP2Pot, turnWinner == 1 ? kP1Win : kP2Win);
+
+            int gameWinner = 0;
+            if (pileSize(position, kP2Deck) + pileSize(position, kP2Win) == 0)
+                gameWinner = 1;
+            else if (pileSize(position, kP1Deck) + pileSize(position, kP1Win) == 0)
+                gameWinner = 2;
+            mOutcomes.push_back(Transition{encode(position, mTotals), probability, gameWinner});
+        }
+
+        const Totals& mTotals; /**<@brief Number of cards of each strength */
+        std::vector<Transition>& mOutcomes; /**<@brief Outcomes found so far */
+};
+
+/**
+ * @brief Calls found(hand, probability) for every hand of handSize cards a player can be dealt from totals,
+ * with the multivariate hypergeometric probability of being dealt it
+ */
+template <class Found>
+void forEachHand(const Totals& totals, int strength, int handSize, Totals& hand, double ways, Found found)
+{
+    if (strength == kStrengths)
+    {
+        if (handSize == 0)
+            found(hand, ways);
+        return;
+    }
+    double choose = 1.0; // totals[strength] choose count
+    for (int count = 0; count <= totals[strength] && count <= handSize; count++)
+    {
+        hand[strength] = static_cast<std::uint8_t>(count);
+        forEachHand(totals, strength + 1, handSize - count, hand, ways * choose, found);
+        choose = choose * (totals[strength] - count) / (count + 1);
+    }
+    hand[strength] = 0;
+}
+
+} // namespace
+
+double WarDistribution::meanLength() const
+{
+    double ended = 0.0;
+    double turns = 0.0;
+    for (std::size_t length = 0; length < gameLength.size(); length++)
+    {
+        ended += gameLength[length];
+        turns += length * gameLength[length];
+    }
+    return ended == 0.0 ? 0.0 : turns / ended;
+}
+
+WarSolver::WarSolver(const std::vector<PlayingCard>& cards)
+{
+    mCardCount = static_cast<unsigned int>(cards.size() - (cards.size() % 2)); // as WarCardGame drops one
+    if (mCardCount < 2)
+        throw std::invalid_argument("WarSolver: at least 2 cards are needed");
+    for (unsigned int i = 0; i < mCardCount; i++)
+    {
+        const int strength = CompactCard(cards[i]).warStrength() - 2;
+        if (mTotals[strength] == std::numeric_limits<std::uint8_t>::max())
+            throw std::invalid_argument("WarSolver: too many cards of one strength");
+        mTotals[strength]++;
+    }
+
+    // Every encoded position must fit in 64 bits
+    std::uint64_t range = 1;
+    for (const auto total : mTotals)
+    {
+        for (int digit = 0; digit < 3 && total != 0; digit++)
+        {
+            if (range > std::numeric_limits<std::uint64_t>::max() / (total + 1u))
+                throw std::invalid_argument("WarSolver: too many cards to solve exactly");
+            range *= total + 1u;
+        }
+    }
+}
+
+WarDistribution WarSolver::solve(unsigned long long maxTurns, double tolerance)
+{
+    WarDistribution result;
+    result.gameLength.push_back(0.0);
+
+    // Player One is dealt a uniformly random half of the cards, and both decks are shuffled
+    std::vector<double> live;
+    double allHands = 1.0; // cards choose half
+    for (unsigned int i = 0; i < mCardCount / 2; i++)
+        allHands = allHands * (mCardCount - i) / (i + 1);
+    Totals hand{};
+    forEachHand(mTotals, 0, static_cast<int>(mCardCount / 2), hand, 1.0, [&](const Totals& dealt, double ways)
+    {
+        Position position{};
+        for (int strength = 0; strength < kStrengths; strength++)
+        {
+            position[kP1Deck][strength] = dealt[strength];
+            position[kP2Deck][strength] = mTotals[strength] - dealt[strength];
+        }
+        const std::uint32_t number = positionNumber(encode(position, mTotals));
+        live.resize(mPositions.size(), 0.0);
+        live[number] += ways / allHands;
+    });
+
+    std::vector<double> next;
+    double stillPlaying = 1.0;
+    for (unsigned long long turn = 1; turn <= maxTurns && stillPlaying >= tolerance; turn++)
+    {
+        double ended = 0.0;
+        stillPlaying = 0.0;
+        next.assign(mPositions.size(), 0.0);
+        for (std::uint32_t number = 0; number < live.size(); number++)
+        {
+            if (live[number] == 0.0)
+                continue;
+            for (const Transition& transition : transitions(number))
+            {
+                const double probability = live[number] * transition.probability;
+                if (transition.winner == 1)
+                    result.playerOneWins += probability;
+                else if (transition.winner == 2)
+                    result.playerTwoWins += probability;
+                else
+                {
+                    if (transition.position >= next.size())
+                        next.resize(mPositions.size(), 0.0);
+                    next[transition.position] += probability;
+                    stillPlaying += probability;
+                    continue;
+                }
+                ended += probability;
+            }
+        }
+        result.gameLength.push_back(ended);
+        live.swap(next);
+    }
+
+    result.unresolved = stillPlaying;
+    result.states = mPositions.size();
+    return result;
+}
+
+std::uint32_t WarSolver::positionNumber(std::uint64_t position)
+{
+    const auto found = mNumbers.emplace(position, static_cast<std::uint32_t>(mPositions.size()));
+    if (found.second)
+    {
+        mPositions.push_back(position);
+        mTransitions.emplace_back();
+        mExpanded.push_back(false);
+    }
+    return found.first->second;
+}
+
+const std::vector<WarSolver::Transition>& WarSolver::transitions(std::uint32_t number)
+{
+    if (mExpanded[number])
+        return mTransitions[number];
+
+    std::vector<Transition> outcomes;
+    TurnExpander<Transition>(mTotals, outcomes).turn(decode(mPositions[number], mTotals), 1.0);
+
+    // Combine the outcomes that reach the same position, and all of the wins of each player
+    for (Transition& outcome : outcomes)
+    {
+        if (outcome.winner != 0)
+            outcome.position = 0;
+    }
+    std::sort(outcomes.begin(), outcomes.end(), [](const Transition& a, const Transition& b)
+    {
+        return a.winner != b.winner ? a.winner < b.winner : a.position < b.position;
+    });
+    std::vector<Transition> merged;
+    for (const Transition& outcome : outcomes)
+    {
+        if (!merged.empty() && merged.back().winner == outcome.winner && merged.back().position == outcome.position)
+            merged.back().probability += outcome.probability;
+        else
+            merged.push_back(outcome);
+    }
+
+    // Number the positions the game goes on to. This can grow the tables, so the result is stored after.
+    for (Transition& outcome : merged)
+    {
+        if (outcome.winner == 0)
+            outcome.position = positionNumber(outcome.position);
+    }
+    mTransitions[number] = std::move(merged);
+    mExpanded[number] = true;
+    return mTransitions[number];
+}
+
+} // namespace doc
@@ -0,0 +1,241 @@
+/**
+ * @file allocator_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for allocator-aware Deck, RingPile and WarCardGame
+ *
+ * This script checks that RingPile and Deck allocate from the allocator or memory resource they are given, that
+ * a deck can shuffle in and place under a pile from another memory resource, and that a game constructed on a
+ * memory resource allocates its decks and piles from it and plays exactly as it does on the heap. Global
+ * operator new is replaced to count allocations, to check a game on an arena never goes to the global heap.
+ */
+
+#include "deck.h"
+#include "playing_card.h"
+#include "ring_pile.h"
+#include "test_check.h"
+#include "war_card_game.h"
+#include "war_simulator.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+std::size_t globalAllocations = 0; /**<@brief Calls to the global operator new */
+
+/**
+ * @brief Memory resource that counts the allocations passed on to its upstream resource
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+    public:
+        std::size_t allocations = 0;
+        std::size_t bytes = 0;
+
+    private:
+        void* do_allocate(std::size_t size, std::size_t alignment) override
+        {
+            allocations++;
+            bytes += size;
+            return std::pmr::new_delete_resource()->allocate(size, alignment);
+        }
+
+        void do_deallocate(void* pointer, std::size_t size, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(pointer, size, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+};
+
+/**
+ * @brief Standard allocator that counts its allocations
+ */
+template <class T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator(std::size_t* count) : allocations(count) {}
+    template <class U>
+    CountingAllocator(const CountingAllocator<U>& other) : allocations(other.allocations) {}
+
+    T* allocate(std::size_t count)
+    {
+        (*allocations)++;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, std::size_t count) { std::allocator<T>().deallocate(pointer, count); }
+
+    std::size_t* allocations;
+};
+
+template <class T, class U>
+bool operator==(const CountingAllocator<T>& a, const CountingAllocator<U>& b) { return a.allocations == b.allocations; }
+
+template <class T, class U>
+bool operator!=(const CountingAllocator<T>& a, const CountingAllocator<U>& b) { return !(a == b); }
+
+std::vector<int> sorted(std::vector<int> values)
+{
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+} // namespace
+
+// Count every allocation from the global heap
+void* operator new(std::size_t size)
+{
+    globalAllocations++;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// std::pmr::new_delete_resource() allocates with the aligned form
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    globalAllocations++;
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<int> values(52);
+    std::iota(values.begin(), values.end(), 0);
+
+    CountingResource resource;
+    doc::pmr::RingPile<int> pile(52, &resource);
+    for (const int value : values)
+        pile.push_back(value);
+    check(resource.allocations == 1 && pile.get_allocator().resource() == &resource && pile.size() == 52,
+            "pmr RingPile allocates its buffer from the resource");
+
+    doc::pmr::Deck<int> deck(std::allocator_arg, &resource, values);
+    deck.seed(3);
+    deck.shuffle();
+    check(deck.get_allocator().resource() == &resource && sorted(deck.contents()) == values,
+            "pmr Deck allocates from the resource and shuffles its cards");
+
+    doc::pmr::Deck<int> fromVector(values);
+    check(fromVector.size() == 52 && fromVector.get_allocator().resource() == std::pmr::get_default_resource(),
+            "pmr Deck constructed from a vector uses the default resource");
+
+    std::size_t allocatorCount = 0;
+    doc::Deck<int, std::mt19937, std::vector<int, CountingAllocator<int>>> counted(std::allocator_arg,
+            CountingAllocator<int>(&allocatorCount), values);
+    counted.shuffle();
+    check(allocatorCount > 0 && sorted(counted.contents()) == values, "Deck allocates with a custom allocator");
+
+    // Piles on another resource cannot exchange storage with the deck, so their cards are moved instead
+    CountingResource other;
+    doc::Deck<int, std::mt19937, doc::pmr::RingPile<int>> empty(std::allocator_arg, &resource);
+    doc::pmr::RingPile<int> otherPile(values, &other);
+    empty.shuffleIn(otherPile);
+    check(empty.size() == 52 && otherPile.empty() && empty.get_allocator().resource() == &resource &&
+            sorted(empty.contents()) == values, "shuffleIn moves the cards of a pile on another resource");
+
+    doc::Deck<int, std::mt19937, doc::pmr::RingPile<int>> under(std::allocator_arg, &resource,
+            std::vector<int>{100, 101});
+    doc::pmr::RingPile<int> below(std::vector<int>{1, 2, 3}, &other);
+    under.placeUnder(below);
+    check(under.contents() == std::vector<int>{1, 2, 3, 100, 101} && below.empty() &&
+            under.get_allocator().resource() == &resource, "placeUnder moves the cards of a pile on another resource");
+
+    // A game on a resource allocates its decks and piles from it, and plays as it does on the heap
+    CountingResource gameResource;
+    doc::SilentWarCardGame onResource(doc::buildStandardDeck(), 17, &gameResource);
+    doc::SilentWarCardGame onHeap(doc::buildStandardDeck(), 17);
+    check(onResource.memoryResource() == &gameResource && gameResource.allocations >= 7 &&
+            gameResource.bytes >= 6 * 52 * sizeof(doc::CompactCard), "game allocates its piles from the resource");
+    const std::size_t afterSetup = gameResource.allocations;
+    onResource.autoPlay();
+    onHeap.autoPlay();
+    check(gameResource.allocations == afterSetup, "playing the game allocates nothing more");
+    check(onResource.snapshot() == onHeap.snapshot() && onResource.turnsPlayed() == onHeap.turnsPlayed(),
+            "game on a resource plays as it does on the heap");
+
+    // Many games fit in a fixed arena that is released between batches
+    std::vector<std::byte> buffer(256 * 1024);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    bool fits = true; // running out of the arena throws std::bad_alloc
+    for (int batch = 0; batch < 4; batch++)
+    {
+        for (std::uint64_t seed = 0; seed < 64; seed++)
+        {
+            doc::SilentWarCardGame game(doc::buildStandardDeck(), seed, &arena);
+            game.autoPlay();
+            fits = fits && game.gameOver();
+        }
+        arena.release();
+    }
+    check(fits, "batches of games fit in a released arena");
+
+    // Simulated games on worker arenas match games played on the heap
+    doc::WarSimulator simulator;
+    const doc::WarSimulationResult simulated = simulator.run(200, 2, 4);
+    bool same = true;
+    for (unsigned long long game = 0; game < simulated.games.size(); game++)
+    {
+        const doc::WarGameResult heap = simulator.playGame(doc::WarSimulator::gameSeed(4, game));
+        same = same && heap.turns == simulated.games[game].turns && heap.wars == simulated.games[game].wars &&
+            heap.outcome == simulated.games[game].outcome;
+    }
+    check(same, "simulated games on worker arenas match games on the heap");
+
+    // A game built and played on an arena, with either win pile rule, never goes to the global heap
+    std::vector<std::byte> gameBuffer(64 * 1024);
+    std::pmr::monotonic_buffer_resource gameArena(gameBuffer.data(), gameBuffer.size(),
+            std::pmr::null_memory_resource());
+    doc::WarSimulator noShuffle;
+    noShuffle.setWinPileRule(doc::WinPileRule::NoShuffle);
+    noShuffle.setTurnCap(100000);
+    const std::size_t beforeGames = globalAllocations;
+    const doc::WarGameResult shuffled = simulator.playGame(doc::WarSimulator::gameSeed(4, 0), &gameArena);
+    gameArena.release();
+    const doc::WarGameResult unshuffled = noShuffle.playGame(doc::WarSimulator::gameSeed(4, 0), &gameArena);
+    const std::size_t gameAllocations = globalAllocations - beforeGames;
+    std::cout << "  " << gameAllocations << " global allocations\n";
+    check(gameAllocations == 0 && shuffled.turns > 0 && unshuffled.turns > 0,
+            "a game on an arena makes no global heap allocations");
+
+    return failures == 0 ? 0 : 1;
+}
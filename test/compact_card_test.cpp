@@ -0,0 +1,50 @@
+/**
+ * @file compact_card_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the CompactCard class
+ *
+ * This script converts every card of a standard deck to a CompactCard and back, checking the conversion is
+ * lossless, and prints each card with its id and War strength.
+ */
+
+#include "compact_card.h"
+#include "playing_card.h"
+#include <iostream>
+
+// The tables are usable at compile time
+static_assert(doc::CompactCard(doc::PlayingCard::Suite::Spades, doc::PlayingCard::Rank::Ace).warStrength() == 14,
+        "Ace is high in War");
+static_assert(doc::CompactCard(51).rank() == doc::PlayingCard::Rank::King, "id 51 is the King of Spades");
+
+int main(int argc, char** argv)
+{
+    int failures = 0;
+    for (const auto& card : doc::buildStandardDeck())
+    {
+        const doc::CompactCard compact(card);
+        const doc::PlayingCard roundTrip = compact.toPlayingCard();
+        std::cout << card.str() << " -> id " << static_cast<int>(compact.id()) << ", strength " <<
+            static_cast<int>(compact.warStrength()) << " -> " << roundTrip.str() << "\n";
+
+        if (roundTrip.suite() != card.suite() || roundTrip.rank() != card.rank() ||
+            compact != doc::CompactCard(compact.id()))
+        {
+            std::cout << "FAILED: " << card.str() << " did not convert back to itself\n";
+            failures++;
+        }
+
+        const int expectedStrength = card.rank() == doc::PlayingCard::Rank::Ace ? 14 :
+            doc::PlayingCard::toInt(card.rank());
+        if (compact.warStrength() != expectedStrength)
+        {
+            std::cout << "FAILED: " << card.str() << " has the wrong War strength\n";
+            failures++;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
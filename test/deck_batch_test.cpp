@@ -0,0 +1,74 @@
+/**
+ * @file deck_batch_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the DeckBatch class and shuffleBatch function
+ *
+ * This script shuffles a batch of 52 card decks, checks every deck still holds each card exactly once and that
+ * the card at the top of the decks is spread evenly over all 52 cards, prints the first few decks, and prints
+ * the time taken per deck.
+ */
+
+#include "deck_batch.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    const std::size_t numDecks = 52 * 2000;
+    doc::DeckBatch batch(numDecks, 52);
+    doc::BatchRng randomGenerator(2022);
+
+#if defined(__AVX2__)
+    std::cout << "Using AVX2\n";
+#else
+    std::cout << "Using portable code\n";
+#endif
+
+    const auto start = std::chrono::steady_clock::now();
+    doc::shuffleBatch(batch, randomGenerator);
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << elapsed.count() / numDecks << " ns per deck\n";
+
+    for (std::size_t deck = 0; deck < 3; deck++)
+    {
+        for (const auto card : batch.contents(deck))
+            std::cout << static_cast<int>(card) << ", ";
+        std::cout << "\n";
+    }
+
+    int failures = 0;
+    std::vector<std::size_t> topCounts(52, 0);
+    for (std::size_t deck = 0; deck < numDecks; deck++)
+    {
+        std::vector<int> seen(52, 0);
+        for (std::size_t position = 0; position < 52; position++)
+            seen[batch.card(deck, position)]++;
+        for (const int count : seen)
+        {
+            if (count != 1)
+            {
+                std::cout << "FAILED: deck " << deck << " is not a permutation\n";
+                failures++;
+                break;
+            }
+        }
+        topCounts[batch.card(deck, 51)]++;
+    }
+
+    // Each card should be on top of about 2000 decks; 6 standard deviations is about 265
+    for (std::size_t card = 0; card < 52; card++)
+    {
+        if (topCounts[card] < 2000 - 265 || topCounts[card] > 2000 + 265)
+        {
+            std::cout << "FAILED: card " << card << " was on top of " << topCounts[card] << " decks\n";
+            failures++;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
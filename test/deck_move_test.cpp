@@ -0,0 +1,108 @@
+/**
+ * @file deck_move_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the move-aware Deck methods
+ *
+ * This script builds a Deck of move-only cards (std::unique_ptr), which only compiles if the methods it uses
+ * never copy a card, moves data in and out, deals in bulk with deal_n and deal_into, emplaces cards at both
+ * ends of std::vector and RingPile storage, and deals with try_deal until the deck is empty.
+ */
+
+#include "deck.h"
+#include "random_engines.h"
+#include "ring_pile.h"
+#include "test_check.h"
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using MoveOnlyCard = std::unique_ptr<int>;
+
+std::vector<MoveOnlyCard> moveOnlyCards(int count)
+{
+    std::vector<MoveOnlyCard> cards;
+    for (int value = 0; value < count; value++)
+        cards.push_back(std::make_unique<int>(value));
+    return cards;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // Moving data in keeps the same storage, so no cards are copied
+    std::vector<MoveOnlyCard> cards = moveOnlyCards(10);
+    const MoveOnlyCard* storage = cards.data();
+    doc::Deck<MoveOnlyCard, doc::Xoshiro256StarStar> deck(std::move(cards));
+    check(deck.size() == 10, "rvalue constructor takes every card");
+
+    std::vector<MoveOnlyCard> taken = deck.take();
+    check(deck.empty() && taken.size() == 10 && taken.data() == storage,
+            "take() returns the deck's storage and leaves the deck empty");
+
+    deck.assign(std::move(taken));
+    check(deck.size() == 10 && *deck.deal_card() == 9,
+            "rvalue assign takes the cards, and deal_card moves the top card out");
+
+    // deal_n deals from the top, in the order dealt
+    std::vector<MoveOnlyCard> hand;
+    deck.deal_n(3, std::back_inserter(hand));
+    check(hand.size() == 3 && *hand[0] == 8 && *hand[1] == 7 && *hand[2] == 6 && deck.size() == 6,
+            "deal_n deals cards from the top of the deck");
+
+    bool threw = false;
+    try
+    {
+        deck.deal_n(7, std::back_inserter(hand));
+    }
+    catch (const doc::EmptyDeckException&)
+    {
+        threw = true;
+    }
+    check(threw && deck.size() == 6, "deal_n throws without dealing if the deck has too few cards");
+
+    MoveOnlyCard dealt[4];
+    check(deck.deal_into(dealt, 4) == 4 && *dealt[0] == 5 && *dealt[3] == 2, "deal_into fills the array");
+    check(deck.deal_into(dealt, 4) == 2 && *dealt[0] == 1 && *dealt[1] == 0 && deck.empty(),
+            "deal_into deals the remaining cards when the deck runs out");
+
+    // emplace at both ends, with std::vector and RingPile storage
+    deck.emplace_top(std::make_unique<int>(1));
+    deck.emplace_bottom(std::make_unique<int>(0));
+    deck.emplace_top(std::make_unique<int>(2));
+    check(*deck.deal_card() == 2 && *deck.deal_card() == 1 && *deck.deal_card() == 0,
+            "emplace_top and emplace_bottom add to the top and bottom of a vector deck");
+
+    doc::Deck<int, doc::Xoshiro256StarStar, doc::RingPile<int>> pileDeck;
+    pileDeck.reserve(3);
+    pileDeck.emplace_top(1);
+    pileDeck.emplace_bottom(0);
+    pileDeck.emplace_top(2);
+    check(pileDeck.contents() == std::vector<int>({0, 1, 2}),
+            "emplace_top and emplace_bottom add to the top and bottom of a RingPile deck");
+
+    // try_deal until empty, with no exceptions
+    int sum = 0;
+    int count = 0;
+    while (const auto card = pileDeck.try_deal())
+    {
+        sum += *card;
+        count++;
+    }
+    check(count == 3 && sum == 3 && !pileDeck.try_deal().has_value(),
+            "try_deal deals every card, then returns none");
+
+    // Moving a deck moves its cards and random number generator
+    doc::Deck<MoveOnlyCard, doc::Xoshiro256StarStar> source(moveOnlyCards(5));
+    doc::Deck<MoveOnlyCard, doc::Xoshiro256StarStar> moved(std::move(source));
+    check(moved.size() == 5, "move constructor takes the cards");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file external_shuffle_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for externalShuffle and FileDeck
+ *
+ * This script shuffles files much larger than the memory it allows the shuffle, so the records go through
+ * bucket files, and buckets too large for memory are split again. It checks that the output is a permutation
+ * of the input, that it depends only on the seed, that a file can be shuffled in place, that FileDeck deals
+ * every record in file order, and that every record is equally likely to end at every position.
+ */
+
+#include "deck.h"
+#include "external_shuffle.h"
+#include "seed_stream.h"
+#include "test_check.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+void writeRecords(const std::string& path, const std::vector<std::uint32_t>& records)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(std::uint32_t));
+}
+
+std::vector<std::uint32_t> readRecords(const std::string& path)
+{
+    std::vector<std::uint32_t> records;
+    doc::FileDeck<std::uint32_t> deck(path, 4096);
+    while (std::optional<std::uint32_t> record = deck.try_deal())
+        records.push_back(*record);
+    return records;
+}
+
+std::vector<std::uint32_t> sequence(std::size_t size)
+{
+    std::vector<std::uint32_t> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string input = "external_shuffle_test_input.bin";
+    const std::string output = "external_shuffle_test_output.bin";
+    const std::string other = "external_shuffle_test_other.bin";
+
+    // 600000 records in 4 KiB of memory: more records than 256 buckets of memory, so buckets are split again
+    const std::vector<std::uint32_t> values = sequence(600000);
+    doc::ExternalShuffleOptions options;
+    options.memoryBytes = 4096;
+    writeRecords(input, values);
+    doc::externalShuffle<std::uint32_t>(input, output, doc::SeedStream(1), options);
+    const std::vector<std::uint32_t> shuffled = readRecords(output);
+    std::vector<std::uint32_t> sorted = shuffled;
+    std::sort(sorted.begin(), sorted.end());
+    check(sorted == values && shuffled != values, "the output is a permutation of the input");
+
+    doc::externalShuffle<std::uint32_t>(input, other, doc::SeedStream(1), options);
+    const bool same = readRecords(other) == shuffled;
+    doc::externalShuffle<std::uint32_t>(input, other, doc::SeedStream(2), options);
+    check(same && readRecords(other) != shuffled, "the shuffle depends only on the seed");
+
+    doc::externalShuffle<std::uint32_t>(input, input, doc::SeedStream(1), options);
+    check(readRecords(input) == shuffled, "a file can be shuffled in place");
+
+    options.memoryBytes = std::size_t(1) << 20;
+    writeRecords(input, values);
+    doc::externalShuffle<std::uint32_t>(input, output, doc::SeedStream(3), options);
+    sorted = readRecords(output);
+    std::sort(sorted.begin(), sorted.end());
+    check(sorted == values, "a file that fits in memory is shuffled in one pass");
+
+    doc::FileDeck<std::uint32_t> deck(input, 4096);
+    bool inOrder = deck.size() == values.size();
+    for (std::size_t i = 0; i < values.size(); i++)
+        inOrder = inOrder && deck.deal_card() == values[i];
+    bool threw = false;
+    try
+    {
+        deck.deal_card();
+    }
+    catch (const doc::EmptyDeckException&)
+    {
+        threw = true;
+    }
+    check(inOrder && deck.empty() && threw && !deck.try_deal(), "FileDeck deals every record in file order");
+
+    writeRecords(input, sequence(5));
+    bool rejected = false;
+    try
+    {
+        doc::externalShuffle<std::uint64_t>(input, output, doc::SeedStream(1));
+    }
+    catch (const std::invalid_argument&)
+    {
+        rejected = true;
+    }
+    check(rejected, "a file that is not a whole number of records is rejected");
+
+    // Position by value counts of a 6 record file, split into buckets of one or two records
+    const int size = 6;
+    const int shuffles = 6000;
+    options.memoryBytes = 2 * sizeof(std::uint32_t);
+    std::vector<int> counts(size * size, 0);
+    for (int i = 0; i < shuffles; i++)
+    {
+        writeRecords(input, sequence(size));
+        doc::externalShuffle<std::uint32_t>(input, output, doc::SeedStream(100 + i), options);
+        const std::vector<std::uint32_t> records = readRecords(output);
+        for (int position = 0; position < size; position++)
+            counts[position * size + records[position]]++;
+    }
+    const int expected = shuffles / size;
+    check(std::all_of(counts.begin(), counts.end(), [expected](int count)
+                { return count > expected * 3 / 4 && count < expected * 5 / 4; }),
+            "every record is equally likely at every position");
+
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+    std::remove(other.c_str());
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file instrumentation_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the hot path instrumentation counters
+ *
+ * This script is built with DOC_INSTRUMENTATION defined. It checks the Deck counters for eager and lazy
+ * shuffles, that a game's turn, war and reshuffle counters match what the game reports, that playing turns
+ * allocates nothing, that counters are kept per thread, and that WarSimulator adds up every thread's counters.
+ */
+
+#include "deck.h"
+#include "instrumentation.h"
+#include "playing_card.h"
+#include "test_check.h"
+#include "war_card_game.h"
+#include "war_simulator.h"
+#include <numeric>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    check(doc::instrumentation::kEnabled, "instrumentation is compiled in");
+
+    std::vector<int> values(52);
+    std::iota(values.begin(), values.end(), 0);
+    doc::Deck<int> deck(values);
+    doc::instrumentation::reset();
+    deck.shuffle();
+    deck.deal_card();
+    std::vector<int> hand(4);
+    deck.deal_n(4, hand.begin());
+    doc::InstrumentationCounters counters = doc::instrumentation::snapshot();
+    check(counters.shuffles == 1 && counters.shuffledElements == 52 && counters.deals == 5,
+            "eager shuffle and deals are counted");
+
+    deck.setShuffleMode(doc::ShuffleMode::Lazy);
+    deck.shuffle();
+    const doc::InstrumentationCounters beforeLazy = doc::instrumentation::snapshot();
+    for (int i = 0; i < 3; i++)
+        deck.deal_card();
+    counters = doc::instrumentation::snapshot() - beforeLazy;
+    check(counters.shuffles == 0 && counters.shuffledElements == 3 && counters.deals == 3,
+            "lazy shuffle counts one element per card dealt");
+
+    // A game's counters match what it reports, and its turns allocate nothing
+    doc::SilentWarCardGame game(doc::buildStandardDeck(), 5);
+    const doc::InstrumentationCounters beforeGame = doc::instrumentation::snapshot();
+    while (!game.gameOver())
+        game.playTurn();
+    counters = doc::instrumentation::snapshot() - beforeGame;
+    check(counters.turns == game.turnsPlayed() && counters.wars == game.warsPlayed() &&
+            counters.reshuffles == game.reshuffles() && counters.deepestWarOnThread >= 1,
+            "turns, wars and reshuffles are counted");
+    check(counters.timedTurns == counters.turns / doc::instrumentation::kTurnSampleInterval &&
+            counters.timedTurnTicks > 0 && counters.ticksPerTurn() > 0.0, "sampled turns are timed");
+    check(counters.allocations == 0, "playing turns allocates nothing");
+
+    const doc::InstrumentationCounters beforeAllocation = doc::instrumentation::snapshot();
+    std::vector<int>* allocated = new std::vector<int>(100);
+    delete allocated;
+    counters = doc::instrumentation::snapshot() - beforeAllocation;
+    check(counters.allocations == 2 && counters.allocatedBytes >= sizeof(std::vector<int>) + 100 * sizeof(int),
+            "allocations are counted by the operator new hook");
+
+    // Another thread's counts are its own
+    const doc::InstrumentationCounters beforeThread = doc::instrumentation::snapshot();
+    doc::InstrumentationCounters threadCounters;
+    std::thread worker([&]()
+    {
+        doc::Deck<int> threadDeck(values);
+        threadDeck.shuffle();
+        threadCounters = doc::instrumentation::snapshot();
+    });
+    worker.join();
+    counters = doc::instrumentation::snapshot() - beforeThread;
+    check(threadCounters.shuffles == 1 && counters.shuffles == 0, "counters are kept per thread");
+
+    // WarSimulator adds up the counts of every worker thread
+    const doc::WarSimulationResult result = doc::WarSimulator().run(500, 4, 6);
+    check(result.instrumentation.turns == result.totalTurns && result.instrumentation.wars == result.totalWars &&
+            result.instrumentation.reshuffles == result.totalReshuffles, "WarSimulator adds up every thread's counts");
+
+    return failures == 0 ? 0 : 1;
+}
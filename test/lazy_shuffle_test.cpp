@@ -0,0 +1,117 @@
+/**
+ * @file lazy_shuffle_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for Deck's lazy shuffle mode
+ *
+ * This script counts the random numbers drawn to check that a lazy shuffle of a large deck costs nothing until
+ * cards are dealt, and half a random number per card dealt after that. It also checks a lazily shuffled deck
+ * keeps its size and contents, that finishing the shuffle for contents() or emplace_top() leaves the dealt
+ * cards and the remaining cards a permutation of the deck, and that a const deck's cards cannot be read while
+ * a shuffle is pending.
+ */
+
+#include "deck.h"
+#include "random_engines.h"
+#include "test_check.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Xoshiro256StarStar that counts the random numbers drawn from it
+ */
+class CountingEngine : public doc::Xoshiro256StarStar
+{
+    public:
+        result_type operator()()
+        {
+            draws++;
+            return doc::Xoshiro256StarStar::operator()();
+        }
+
+        static unsigned long long draws; /**<@brief Random numbers drawn by every CountingEngine */
+};
+
+unsigned long long CountingEngine::draws = 0;
+
+std::vector<int> sequence(int size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int deckSize = 1000000;
+    doc::Deck<int, CountingEngine> deck(sequence(deckSize));
+    deck.seed(1);
+    deck.setShuffleMode(doc::ShuffleMode::Lazy);
+
+    CountingEngine::draws = 0;
+    deck.shuffle();
+    check(CountingEngine::draws == 0 && deck.size() == deckSize, "lazy shuffle draws no random numbers");
+
+    std::vector<int> dealt;
+    for (int i = 0; i < 5; i++)
+        dealt.push_back(deck.deal_card());
+    deck.deal_n(5, std::back_inserter(dealt));
+    check(CountingEngine::draws == 5 && deck.size() == deckSize - 10,
+            "dealing 10 cards draws 5 random numbers, two indices from each");
+    check(dealt != std::vector<int>({999999, 999998, 999997, 999996, 999995, 999994, 999993, 999992, 999991,
+            999990}), "dealt cards are shuffled");
+
+    // A const deck cannot finish the shuffle, so it refuses to show its cards
+    const doc::Deck<int, CountingEngine>& constDeck = deck;
+    bool threw = false;
+    try
+    {
+        constDeck.contents();
+    }
+    catch (const std::logic_error&)
+    {
+        threw = true;
+    }
+    check(threw && deck.shufflePending() && CountingEngine::draws == 5,
+            "const contents() throws while a shuffle is pending, and changes nothing");
+
+    // contents() finishes the shuffle, and the deck still holds every card that was not dealt
+    std::vector<int> all = deck.contents();
+    check(all.size() == deckSize - 10 && CountingEngine::draws > 10, "contents() finishes the pending shuffle");
+    check(!deck.shufflePending() && constDeck.contents() == deck.contents(),
+            "const contents() shows the cards of a settled deck");
+    all.insert(all.end(), dealt.begin(), dealt.end());
+    std::sort(all.begin(), all.end());
+    check(all == sequence(deckSize), "dealt and remaining cards are a permutation of the deck");
+
+    // emplace_top() finishes the shuffle before adding the card, so the new card is dealt first
+    doc::Deck<int, CountingEngine> small(sequence(52));
+    small.seed(2);
+    small.setShuffleMode(doc::ShuffleMode::Lazy);
+    small.shuffle();
+    small.emplace_top(100);
+    check(small.deal_card() == 100 && small.size() == 52, "emplace_top() adds to the top of a lazily shuffled deck");
+
+    // Switching back to eager mode finishes the pending shuffle
+    small.shuffle();
+    small.setShuffleMode(doc::ShuffleMode::Eager);
+    CountingEngine::draws = 0;
+    std::vector<int> remaining;
+    while (auto card = small.try_deal())
+        remaining.push_back(*card);
+    std::sort(remaining.begin(), remaining.end());
+    check(CountingEngine::draws == 0 && remaining == sequence(52), "eager mode deals with no further shuffling");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file parallel_shuffle_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for ThreadPool and Deck::shuffle(ParallelPolicy)
+ *
+ * This script checks that ThreadPool runs every task once and reports a task's exception, that a parallel
+ * shuffle of a large deck is a permutation of it, that it depends on the seed and number of blocks but not on
+ * the pool it runs on, and that elements which own memory are moved through the shuffle's buffer intact. The
+ * uniformity of the parallel shuffle is checked by shuffle_quality_test.
+ */
+
+#include "deck.h"
+#include "parallel_shuffle.h"
+#include "random_engines.h"
+#include "test_check.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::vector<int> sequence(std::size_t size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+/**
+ * @brief Returns a large deck shuffled in parallel
+ */
+std::vector<int> parallelShuffled(const std::vector<int>& values, std::uint64_t seed, doc::ParallelPolicy policy)
+{
+    doc::Deck<int, doc::Xoshiro256StarStar> deck(values);
+    deck.seed(seed);
+    deck.shuffle(policy);
+    return deck.contents();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    doc::ThreadPool pool(4);
+    std::vector<std::atomic<int>> runs(1000);
+    pool.run(runs.size(), [&runs](std::size_t index) { runs[index]++; });
+    pool.run(runs.size(), [&runs](std::size_t index) { runs[index]++; });
+    check(pool.size() == 4 && std::all_of(runs.begin(), runs.end(), [](const std::atomic<int>& count)
+                { return count == 2; }), "ThreadPool runs every task once per run");
+
+    bool threw = false;
+    try
+    {
+        pool.run(100, [](std::size_t index)
+        {
+            if (index == 37)
+                throw std::runtime_error("task failed");
+        });
+    }
+    catch (const std::runtime_error&)
+    {
+        threw = true;
+    }
+    check(threw, "ThreadPool rethrows a task's exception");
+
+    const std::vector<int> values = sequence(1000000);
+    const std::vector<int> shuffled = parallelShuffled(values, 1, doc::ParallelPolicy{4});
+    std::vector<int> sorted = shuffled;
+    std::sort(sorted.begin(), sorted.end());
+    check(sorted == values && shuffled != values, "a parallel shuffle is a permutation of the deck");
+
+    check(parallelShuffled(values, 1, doc::ParallelPolicy{4, &pool}) == shuffled &&
+            parallelShuffled(values, 1, doc::ParallelPolicy{4, nullptr}) == shuffled,
+            "the same seed and number of blocks shuffle identically on any pool");
+    check(parallelShuffled(values, 2, doc::ParallelPolicy{4, &pool}) != shuffled &&
+            parallelShuffled(values, 1, doc::ParallelPolicy{3, &pool}) != shuffled,
+            "different seeds or numbers of blocks shuffle differently");
+
+    // Decks smaller than minParallelSize are shuffled by knuthShuffle
+    doc::Deck<int, doc::Xoshiro256StarStar> small(sequence(52));
+    small.seed(3);
+    small.shuffle(doc::ParallelPolicy{4, &pool});
+    std::vector<int> expected = sequence(52);
+    doc::Xoshiro256StarStar generator(3);
+    doc::knuthShuffle(expected, generator);
+    check(small.contents() == expected, "small decks are shuffled on the calling thread");
+
+    std::vector<std::string> words;
+    for (int i = 0; i < 20000; i++)
+        words.push_back("a string long enough to own its memory, number " + std::to_string(i));
+    doc::Deck<std::string> wordDeck(words);
+    wordDeck.setShuffleMode(doc::ShuffleMode::Lazy);
+    wordDeck.shuffle();
+    wordDeck.shuffle(doc::ParallelPolicy{3, &pool, 0});
+    std::vector<std::string> shuffledWords = wordDeck.contents();
+    const bool moved = shuffledWords != words;
+    std::sort(shuffledWords.begin(), shuffledWords.end());
+    std::sort(words.begin(), words.end());
+    check(moved && shuffledWords == words, "elements owning memory are shuffled intact");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file random_engines_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the random number generators in random_engines.h
+ *
+ * This script checks each generator against published reference output, checks that jumping ahead gives
+ * the same values as stepping ahead, and shuffles a Deck with each generator, printing the result.
+ */
+
+#include "deck.h"
+#include "random_engines.h"
+#include "test_check.h"
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+template <class Rng>
+void printShuffle(const char* name)
+{
+    std::vector<int> cards(10);
+    std::iota(cards.begin(), cards.end(), 1);
+    doc::Deck<int, Rng> deck(cards);
+    deck.seed(2022);
+    deck.shuffle();
+
+    std::cout << name << " (" << sizeof(Rng) << " bytes of state): ";
+    while (!deck.empty())
+        std::cout << deck.deal_card() << ", ";
+    std::cout << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    doc::SplitMix64 splitMix(1234567);
+    check(splitMix() == 6457827717110365317ULL && splitMix() == 3203168211198807973ULL &&
+            splitMix() == 9817491932198370423ULL, "SplitMix64 matches reference output");
+
+    doc::Xoshiro256StarStar xoshiro(0);
+    check(xoshiro() == 11091344671253066420ULL && xoshiro() == 13793997310169335082ULL &&
+            xoshiro() == 1900383378846508768ULL, "Xoshiro256StarStar matches reference output");
+
+    doc::Pcg32 pcg(42, 54); // pcg32-demo
+    check(pcg() == 0xa15c02b7 && pcg() == 0x7b47f409 && pcg() == 0xba1d3330 && pcg() == 0x83d2f293,
+            "Pcg32 matches reference output");
+
+    doc::SplitMix64 stepped(99);
+    doc::SplitMix64 skipped(99);
+    for (int i = 0; i < 1000; i++)
+        stepped();
+    skipped.discard(1000);
+    check(stepped == skipped, "SplitMix64 discard matches stepping");
+
+    doc::Pcg32 pcgStepped(7, 3);
+    doc::Pcg32 pcgSkipped(7, 3);
+    for (int i = 0; i < 12345; i++)
+        pcgStepped();
+    pcgSkipped.advance(12345);
+    check(pcgStepped == pcgSkipped, "Pcg32 advance matches stepping");
+
+    doc::Pcg32 otherStream(7, 4);
+    check(otherStream() != doc::Pcg32(7, 3)(), "Pcg32 streams differ");
+
+    doc::Xoshiro256StarStar first(5);
+    doc::Xoshiro256StarStar second(5);
+    second.jump();
+    doc::Xoshiro256StarStar third(5);
+    third.long_jump();
+    check(first != second && second != third && first() != second(), "Xoshiro256StarStar jumps to new streams");
+
+    printShuffle<std::mt19937>("std::mt19937");
+    printShuffle<doc::SplitMix64>("SplitMix64");
+    printShuffle<doc::Xoshiro256StarStar>("Xoshiro256StarStar");
+    printShuffle<doc::Pcg32>("Pcg32");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file ring_pile_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the RingPile class
+ *
+ * This script adds and removes cards from both ends of a RingPile so that it wraps around its buffer, checks
+ * the pile holds the expected cards, and uses a RingPile as the storage of a Deck.
+ */
+
+#include "deck.h"
+#include "ring_pile.h"
+#include "test_check.h"
+#include <algorithm>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    doc::RingPile<int> pile(5);
+    for (int value = 1; value <= 3; value++)
+        pile.push_back(value); // bottom 1 2 3 top
+    pile.pop_front();
+    pile.pop_front();
+    pile.push_back(4);
+    pile.push_back(5);
+    pile.push_front(0); // wraps around: bottom 0 3 4 5 top
+    pile.push_front(-1);
+    check(std::vector<int>(pile.begin(), pile.end()) == std::vector<int>({-1, 0, 3, 4, 5}),
+            "adding to both ends wraps around the buffer");
+    check(pile.front() == -1 && pile.back() == 5, "front is the bottom and back is the top");
+
+    bool threw = false;
+    try
+    {
+        pile.push_back(6);
+    }
+    catch (const std::length_error&)
+    {
+        threw = true;
+    }
+    check(threw, "adding to a full pile throws");
+
+    doc::RingPile<int> other(5);
+    other.push_back(42);
+    pile.swap(other);
+    check(pile.size() == 1 && pile.back() == 42 && other.size() == 5, "swap exchanges contents");
+
+    pile.reserve(10);
+    check(pile.capacity() == 10 && pile.back() == 42, "reserve keeps contents");
+
+    doc::Deck<int, std::mt19937, doc::RingPile<int>> deck(std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    doc::RingPile<int> winPile(10);
+    deck.shuffle();
+    while (!deck.empty())
+        winPile.push_back(deck.deal_card());
+    deck.shuffleIn(winPile);
+    check(deck.size() == 10 && winPile.empty() && winPile.capacity() == 10,
+            "shuffling a pile into an empty deck exchanges their storage");
+
+    std::vector<int> contents = deck.contents();
+    std::sort(contents.begin(), contents.end());
+    check(contents == std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}), "deck holds every card after shuffling");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file sampling_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for Deck::sample, Deck::deal_random and ReservoirSampler
+ *
+ * This script checks that samples are distinct cards of the deck, leave the deck as it is, and are
+ * reproducible from the deck's seed; that every card is equally likely to be sampled, and to be first in the
+ * sample, with both Floyd's algorithm and the partial Fisher-Yates shuffle; that deal_random() removes exactly
+ * the cards it returns; and that ReservoirSampler keeps every card of a stream with equal probability, and is
+ * reproducible from a SeedStream.
+ */
+
+#include "deck.h"
+#include "random_engines.h"
+#include "reservoir_sampler.h"
+#include "seed_stream.h"
+#include "test_check.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <set>
+#include <vector>
+
+namespace
+{
+
+std::vector<int> sequence(std::size_t size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+/**
+ * @brief Returns if counts that should all equal expected pass a chi-square test. The statistic must be within
+ * six standard deviations of its mean, which a uniform sample fails about once in 10^8 runs.
+ */
+bool near(const std::vector<int>& counts, double expected)
+{
+    double statistic = 0.0;
+    for (const int count : counts)
+        statistic += (count - expected) * (count - expected) / expected;
+    const double degreesOfFreedom = counts.size() - 1.0;
+    std::cout << "  chi-square " << statistic << ", " << degreesOfFreedom << " degrees of freedom\n";
+    return std::abs(statistic - degreesOfFreedom) < 6.0 * std::sqrt(2.0 * degreesOfFreedom);
+}
+
+/**
+ * @brief Samples count of size cards many times, and checks every card is equally likely to be in the sample,
+ * and to be first
+ */
+bool uniformSample(std::size_t size, std::size_t count)
+{
+    const int samples = 40000;
+    doc::Deck<int, doc::Xoshiro256StarStar> deck(sequence(size));
+    deck.seed(21);
+    std::vector<int> included(size, 0);
+    std::vector<int> first(size, 0);
+    std::vector<int> sample;
+    for (int i = 0; i < samples; i++)
+    {
+        sample.clear();
+        deck.sample(count, std::back_inserter(sample));
+        for (const int card : sample)
+            included[card]++;
+        first[sample.front()]++;
+    }
+    return near(included, static_cast<double>(samples) * count / size) &&
+        near(first, static_cast<double>(samples) / size);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // 1000 of 10^6 cards uses Floyd's algorithm, and 7 of 52 the partial Fisher-Yates shuffle
+    const std::vector<int> values = sequence(1000000);
+    doc::Deck<int, doc::Xoshiro256StarStar> large(values);
+    large.seed(5);
+    std::vector<int> sample;
+    large.sample(1000, std::back_inserter(sample));
+    const std::set<int> distinct(sample.begin(), sample.end());
+    check(sample.size() == 1000 && distinct.size() == 1000 && *distinct.rbegin() < 1000000 &&
+            large.contents() == values, "a small sample is distinct cards of the deck, which is left as it is");
+
+    doc::Deck<int, doc::Xoshiro256StarStar> hand(sequence(52));
+    hand.seed(5);
+    int cards[7];
+    int* end = hand.sample(7, cards);
+    const std::set<int> distinctHand(cards, end);
+    check(end == cards + 7 && distinctHand.size() == 7 && hand.size() == 52,
+            "a large sample is distinct cards of the deck");
+
+    doc::Deck<int, doc::Xoshiro256StarStar> again(sequence(52));
+    again.seed(5);
+    int sameCards[7];
+    again.sample(7, sameCards);
+    check(std::equal(cards, cards + 7, sameCards), "decks seeded alike sample alike");
+
+    std::vector<int> all;
+    hand.sample(100, std::back_inserter(all));
+    std::sort(all.begin(), all.end());
+    check(all == sequence(52), "sampling more cards than the deck has copies every card");
+
+    check(uniformSample(400, 5), "every card is equally likely with Floyd's algorithm");
+    check(uniformSample(40, 5), "every card is equally likely with the partial Fisher-Yates shuffle");
+
+    doc::Deck<int, doc::Xoshiro256StarStar> dealer(sequence(52));
+    dealer.seed(9);
+    std::vector<int> dealt = dealer.deal_random(13);
+    std::vector<int> rest = dealer.contents();
+    const bool sizes = dealt.size() == 13 && rest.size() == 39;
+    rest.insert(rest.end(), dealt.begin(), dealt.end());
+    std::sort(rest.begin(), rest.end());
+    bool threw = false;
+    try
+    {
+        dealer.deal_random(40);
+    }
+    catch (const doc::EmptyDeckException&)
+    {
+        threw = true;
+    }
+    check(sizes && rest == sequence(52) && threw && dealer.size() == 39,
+            "deal_random removes exactly the cards it returns");
+
+    // Every card of a stream of 1000 is equally likely to be kept in a sample of 10
+    std::vector<int> kept(1000, 0);
+    const int streams = 20000;
+    for (int i = 0; i < streams; i++)
+    {
+        doc::ReservoirSampler<int, doc::Xoshiro256StarStar> sampler(10, i);
+        for (int card = 0; card < 1000; card++)
+            sampler.add(card);
+        for (const int card : sampler.sample())
+            kept[card]++;
+    }
+    check(near(kept, streams * 10 / 1000.0), "ReservoirSampler keeps every card with equal probability");
+
+    doc::ReservoirSampler<int> few(10, 1);
+    const std::vector<int> five = sequence(5);
+    few.add(five.begin(), five.end());
+    check(few.seen() == 5 && few.sample() == five, "ReservoirSampler keeps every card of a short stream");
+
+    doc::ReservoirSampler<int, doc::Xoshiro256StarStar> fromStream(10, doc::SeedStream(7));
+    doc::ReservoirSampler<int, doc::Xoshiro256StarStar> sameStream(10, doc::SeedStream(7));
+    doc::ReservoirSampler<int, doc::Xoshiro256StarStar> unseeded(10);
+    const std::vector<int> stream = sequence(1000);
+    fromStream.add(stream.begin(), stream.end());
+    sameStream.add(stream.begin(), stream.end());
+    unseeded.add(stream.begin(), stream.end());
+    check(fromStream.sample() == sameStream.sample() && unseeded.sample().size() == 10,
+            "ReservoirSamplers seeded from the same SeedStream keep the same cards");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file seed_stream_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for SeedStream and the seeding of decks constructed without a seed
+ *
+ * This script checks that a stream's children and indexed seeds agree with its sequence and with
+ * WarSimulator's game seeds, that decks seeded from the same stream shuffle identically, that std::mt19937 is
+ * seeded with its whole state, and that unseeded decks and games are seeded from their thread's stream, so
+ * they can be reproduced from it.
+ */
+
+#include "deck.h"
+#include "playing_card.h"
+#include "random_engines.h"
+#include "seed_stream.h"
+#include "test_check.h"
+#include "war_card_game.h"
+#include "war_simulator.h"
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    doc::seeding::setProcessSeed(42);
+    check(doc::seeding::processSeed() == 42 && doc::seeding::threadStream() == doc::SeedStream(42).child(0),
+            "the first thread's stream is the process stream's first child");
+
+    doc::SeedStream stream(7);
+    const doc::SeedStream start = stream;
+    bool indexed = true;
+    for (std::uint64_t index = 0; index < 100; index++)
+        indexed = indexed && start.at(index) == stream.next();
+    check(indexed, "at(index) is the index-th value of the stream, without advancing it");
+    check(start.child(3) == doc::SeedStream(start.at(3)) && start.child(3) != start.child(4),
+            "children are seeded by the stream's values");
+    check(doc::WarSimulator::gameSeed(11, 25) == doc::SeedStream(11).at(25), "game seeds are the master stream's");
+
+    std::vector<int> values(52);
+    std::iota(values.begin(), values.end(), 0);
+    doc::Deck<int> first(values, doc::SeedStream(5));
+    doc::Deck<int> second(values, doc::SeedStream(5));
+    doc::Deck<int> third(values, doc::SeedStream(6));
+    first.shuffle();
+    second.shuffle();
+    third.shuffle();
+    check(first.contents() == second.contents() && first.contents() != third.contents(),
+            "decks seeded from the same stream shuffle identically");
+
+    // std::mt19937 takes its whole state from the stream, rather than one 32-bit value
+    std::mt19937 fromStream;
+    doc::SeedStream(9).seed(fromStream);
+    std::mt19937 fromValue(static_cast<std::mt19937::result_type>(doc::SeedStream(9).next()));
+    std::mt19937 fromStreamAgain;
+    doc::SeedStream(9).seed(fromStreamAgain);
+    check(fromStream != fromValue && fromStream == fromStreamAgain, "std::mt19937 is seeded with its whole state");
+
+    doc::Xoshiro256StarStar xoshiro;
+    doc::SeedStream(9).seed(xoshiro);
+    check(xoshiro == doc::Xoshiro256StarStar(doc::SeedStream(9).next()),
+            "engines without seed sequences are seeded with the next value");
+
+    // Unseeded decks and games are seeded from the thread's stream, and can be reproduced from it
+    const doc::SeedStream saved = doc::seeding::threadStream();
+    doc::Deck<int> unseeded(values);
+    doc::SilentWarCardGame unseededGame;
+    unseeded.shuffle();
+    unseededGame.autoPlay();
+    doc::seeding::threadStream() = saved;
+    doc::Deck<int> replayed(values);
+    doc::SilentWarCardGame replayedGame;
+    replayed.shuffle();
+    replayedGame.autoPlay();
+    check(unseeded.contents() == replayed.contents() && unseededGame.snapshot() == replayedGame.snapshot(),
+            "unseeded decks and games are reproduced from the thread's stream");
+
+    doc::SeedStream otherThread;
+    std::thread worker([&otherThread]() { otherThread = doc::seeding::threadStream(); });
+    worker.join();
+    check(otherThread == doc::SeedStream(42).child(1), "each thread has its own child stream");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file shoe_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the Shoe class
+ *
+ * This script deals a whole 6 deck shoe and checks it holds 6 of every card, checks the cut card is reached
+ * at the penetration and shuffles the shoe at the end of the hand, plays many hands in continuous shuffle mode
+ * and checks each hand puts back exactly the cards dealt, deals from a shoe of a million decks, and checks a
+ * shoe seeded with a number or a SeedStream deals the same cards every time.
+ */
+
+#include "playing_card.h"
+#include "random_engines.h"
+#include "seed_stream.h"
+#include "shoe.h"
+#include "test_check.h"
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using CardShoe = doc::Shoe<doc::PlayingCard, doc::Xoshiro256StarStar>;
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::vector<doc::PlayingCard> deck = doc::buildStandardDeck();
+
+    CardShoe shoe(deck, 6);
+    shoe.seed(1);
+    check(shoe.capacity() == 312 && shoe.size() == 312 && shoe.numDecks() == 6, "shoe holds 6 decks");
+
+    std::map<std::string, int> counts;
+    while (!shoe.empty())
+        counts[shoe.deal_card().str()]++;
+    bool sixOfEach = counts.size() == 52;
+    for (const auto& count : counts)
+        sixOfEach = sixOfEach && count.second == 6;
+    check(sixOfEach, "dealing the whole shoe deals 6 of every card");
+
+    bool threw = false;
+    try
+    {
+        shoe.deal_card();
+    }
+    catch (const doc::EmptyDeckException&)
+    {
+        threw = true;
+    }
+    check(threw, "dealing from an empty shoe throws");
+
+    // Cut card at 75% of 312 cards is after 234 cards
+    shoe.shuffle();
+    for (int i = 0; i < 233; i++)
+        shoe.deal_card();
+    check(!shoe.cutCardReached() && !shoe.endHand() && shoe.size() == 79, "cut card not reached after 233 cards");
+    shoe.deal_card();
+    check(shoe.cutCardReached(), "cut card reached after 234 cards");
+    check(shoe.endHand() && shoe.size() == 312 && !shoe.cutCardReached(), "end of hand shuffles the shoe");
+
+    // A continuous shuffle shoe never runs out, since each hand's cards go back in
+    CardShoe machine(deck, 8, doc::ShoeMode::ContinuousShuffle);
+    machine.seed(2);
+    bool alwaysFull = true;
+    for (int hand = 0; hand < 10000; hand++)
+    {
+        for (int card = 0; card < 10; card++)
+            machine.deal_card();
+        alwaysFull = machine.endHand() && alwaysFull && machine.size() == 416 && !machine.cutCardReached();
+    }
+    check(alwaysFull, "continuous shuffle returns every hand's cards to the shoe");
+
+    // A continuous shuffle hand puts back only the cards it dealt, so the whole shoe still holds 8 of each
+    for (int card = 0; card < 300; card++)
+        machine.deal_card();
+    machine.endHand();
+    std::map<std::string, int> machineCounts;
+    while (!machine.empty())
+        machineCounts[machine.deal_card().str()]++;
+    bool eightOfEach = machineCounts.size() == 52;
+    for (const auto& count : machineCounts)
+        eightOfEach = eightOfEach && count.second == 8;
+    check(eightOfEach && machine.endHand() && machine.size() == 416 && !machine.endHand(),
+            "continuous shuffle puts back exactly the cards dealt in the hand");
+
+    // Seeded shoes deal the same cards
+    CardShoe first(deck, 2);
+    CardShoe second(deck, 2);
+    first.seed(3);
+    second.seed(3);
+    bool same = true;
+    for (int i = 0; i < 104; i++)
+        same = same && first.deal_card().str() == second.deal_card().str();
+    check(same, "shoes with the same seed deal the same cards");
+
+    CardShoe fromStream(deck, 2, doc::SeedStream(5).split(), doc::ShoeMode::ContinuousShuffle);
+    CardShoe reseeded(deck, 2, doc::ShoeMode::ContinuousShuffle);
+    reseeded.seed(doc::SeedStream(5).split());
+    bool sameStream = fromStream.mode() == doc::ShoeMode::ContinuousShuffle;
+    for (int i = 0; i < 104; i++)
+        sameStream = sameStream && fromStream.deal_card().str() == reseeded.deal_card().str();
+    check(sameStream, "shoes seeded from the same SeedStream deal the same cards");
+
+    // A huge shoe holds only a count per card, so it is built and dealt from without holding every copy
+    CardShoe huge(deck, 1000000);
+    huge.seed(4);
+    std::map<std::string, int> hugeCounts;
+    for (int i = 0; i < 52000; i++)
+        hugeCounts[huge.deal_card().str()]++;
+    bool spread = huge.capacity() == 52000000 && huge.size() == 52000000 - 52000 && hugeCounts.size() == 52;
+    for (const auto& count : hugeCounts)
+        spread = spread && count.second > 800 && count.second < 1200;
+    check(spread, "a million deck shoe deals every card about equally often");
+
+    threw = false;
+    try
+    {
+        CardShoe invalid(deck, 6, doc::ShoeMode::CutCard, 1.5);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check(threw, "penetration above 1 throws");
+
+    return failures == 0 ? 0 : 1;
+}
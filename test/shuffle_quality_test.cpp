@@ -0,0 +1,430 @@
+/**
+ * @file shuffle_quality_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Statistical test of shuffle quality, for each shuffle and random number generator in the library.
+ *
+ * For each shuffle (knuthShuffle, Deck, parallel Deck, Shoe and DeckBatch) this script runs millions of
+ * shuffles and checks, with chi-square tests:
+ *  - the position-by-value frequency matrix of a 10 element shuffle, where every value should be equally
+ *    likely at every position
+ *  - the frequency of every permutation of 4 and 5 element shuffles, which should all be equally likely
+ *  - the joint frequency of the values at adjacent positions of a 10 element shuffle, which should be equally
+ *    likely for every pair of distinct values, so neighbouring values are not correlated
+ *
+ * A test fails if its p-value is below 1e-6, or above 1 - 1e-6 (too perfect to be random). The generators are
+ * seeded with fixed values, so the results are reproducible. As a check that the tests can detect bias, the
+ * naive shuffle that swaps every element with one chosen from the whole range must fail.
+ *
+ * Exits with 1 if any test fails. Pass a number to scale the number of shuffles, e.g. 0.1 for a quick run.
+ */
+
+#include "deck.h"
+#include "deck_batch.h"
+#include "parallel_shuffle.h"
+#include "random_engines.h"
+#include "shoe.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const double kSignificance = 1e-6; /**<@brief p-values below this, or above 1 minus this, fail */
+
+/** @brief Shuffles a vector of values in place */
+using Shuffler = std::function<void(std::vector<int>&)>;
+
+/**
+ * @brief Returns the regularized upper incomplete gamma function Q(a, x)
+ * See Numerical Recipes, section 6.2
+ */
+double upperGamma(double a, double x)
+{
+    if (x <= 0.0)
+        return 1.0;
+
+    const double logPrefix = -x + a * std::log(x) - std::lgamma(a);
+    if (x < a + 1.0)
+    {
+        // series for the lower function P(a, x)
+        double term = 1.0 / a;
+        double sum = term;
+        for (int n = 1; n < 10000; n++)
+        {
+            term *= x / (a + n);
+            sum += term;
+            if (std::fabs(term) < std::fabs(sum) * 1e-15)
+                break;
+        }
+        return 1.0 - sum * std::exp(logPrefix);
+    }
+
+    // continued fraction for Q(a, x), modified Lentz's method
+    const double tiny = 1e-300;
+    double b = x + 1.0 - a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double h = d;
+    for (int i = 1; i < 10000; i++)
+    {
+        const double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        if (std::fabs(d) < tiny)
+            d = tiny;
+        c = b + an / c;
+        if (std::fabs(c) < tiny)
+            c = tiny;
+        d = 1.0 / d;
+        const double delta = d * c;
+        h *= delta;
+        if (std::fabs(delta - 1.0) < 1e-15)
+            break;
+    }
+    return std::exp(logPrefix) * h;
+}
+
+/**
+ * @brief Returns the p-value of a chi-square statistic
+ */
+double chiSquarePValue(double statistic, double degreesOfFreedom)
+{
+    return upperGamma(degreesOfFreedom / 2.0, statistic / 2.0);
+}
+
+/**
+ * @brief Returns the chi-square statistic of observed counts that should all equal expected
+ */
+double chiSquare(const std::vector<unsigned long long>& observed, double expected)
+{
+    double statistic = 0.0;
+    for (const auto count : observed)
+    {
+        const double difference = static_cast<double>(count) - expected;
+        statistic += difference * difference / expected;
+    }
+    return statistic;
+}
+
+/**
+ * @brief Tests and prints the results of the shuffles
+ */
+class QualityTester
+{
+    public:
+
+        explicit QualityTester(double scale) : mScale(scale) {}
+
+        /**
+         * @brief Runs every test on a shuffle
+         * @param[in] name Name of the shuffle, to print
+         * @param[in] shuffle Shuffle to test
+         * @param[in] expectFailure True if the shuffle is known to be biased, and should fail
+         */
+        void testShuffle(const std::string& name, const Shuffler& shuffle, bool expectFailure = false)
+        {
+            std::cout << name << ":\n";
+            const int failuresBefore = mTestFailures;
+            positionMatrix(shuffle, 10, count(1000000));
+            permutations(shuffle, 4, count(2400000));
+            permutations(shuffle, 5, count(2400000));
+            adjacentPairs(shuffle, 10, count(1000000));
+            const bool failed = mTestFailures > failuresBefore;
+
+            if (expectFailure)
+            {
+                // A biased shuffle failing is the expected outcome
+                mTestFailures = failuresBefore;
+                if (!failed)
+                {
+                    std::cout << "  FAILED: the tests did not detect this biased shuffle\n";
+                    mTestFailures++;
+                }
+                else
+                    std::cout << "  bias detected, as expected\n";
+            }
+        }
+
+        /**
+         * @brief Checks the position-by-value frequency matrix of shuffles
+         * @param[in] counts Position-by-value counts, position major
+         * @param[in] size Number of elements shuffled
+         * @param[in] shuffles Number of shuffles counted
+         */
+        void checkPositionMatrix(const std::vector<unsigned long long>& counts, int size, unsigned long long shuffles)
+        {
+            // Row and column sums are fixed, so (size - 1)^2 degrees of freedom
+            const double statistic = chiSquare(counts, static_cast<double>(shuffles) / size);
+            report("position by value, n = " + std::to_string(size), statistic, (size - 1.0) * (size - 1.0));
+        }
+
+        /**
+         * @brief Returns if every test passed
+         */
+        bool passed() const { return mTestFailures == 0; }
+
+    private:
+
+        unsigned long long count(unsigned long long full) const
+        {
+            return static_cast<unsigned long long>(full * mScale);
+        }
+
+        void report(const std::string& test, double statistic, double degreesOfFreedom)
+        {
+            const double pValue = chiSquarePValue(statistic, degreesOfFreedom);
+            const bool failed = pValue < kSignificance || pValue > 1.0 - kSignificance;
+            std::cout << "  " << (failed ? "FAILED " : "passed ") << test << ": chi-square " << statistic <<
+                ", " << degreesOfFreedom << " degrees of freedom, p = " << pValue << "\n";
+            if (failed)
+                mTestFailures++;
+        }
+
+        void positionMatrix(const Shuffler& shuffle, int size, unsigned long long shuffles)
+        {
+            std::vector<unsigned long long> counts(size * size, 0);
+            std::vector<int> values(size);
+            for (unsigned long long i = 0; i < shuffles; i++)
+            {
+                std::iota(values.begin(), values.end(), 0);
+                shuffle(values);
+                for (int position = 0; position < size; position++)
+                    counts[position * size + values[position]]++;
+            }
+            checkPositionMatrix(counts, size, shuffles);
+        }
+
+        void permutations(const Shuffler& shuffle, int size, unsigned long long shuffles)
+        {
+            int permutationCount = 1;
+            for (int i = 2; i <= size; i++)
+                permutationCount *= i;
+
+            std::vector<unsigned long long> counts(permutationCount, 0);
+            std::vector<int> values(size);
+            for (unsigned long long i = 0; i < shuffles; i++)
+            {
+                std::iota(values.begin(), values.end(), 0);
+                shuffle(values);
+                counts[permutationRank(values)]++;
+            }
+            const double statistic = chiSquare(counts, static_cast<double>(shuffles) / permutationCount);
+            report("permutation frequency, n = " + std::to_string(size), statistic, permutationCount - 1.0);
+        }
+
+        void adjacentPairs(const Shuffler& shuffle, int size, unsigned long long shuffles)
+        {
+            // Joint frequency of (value at position p, value at position p + 1). The pairs within one shuffle
+            // are not independent, so each shuffle counts one pair, cycling through the positions.
+            std::vector<unsigned long long> counts(size * size, 0);
+            std::vector<int> values(size);
+            double sumProducts = 0.0;
+            for (unsigned long long i = 0; i < shuffles; i++)
+            {
+                std::iota(values.begin(), values.end(), 0);
+                shuffle(values);
+                const std::size_t position = i % (size - 1);
+                counts[values[position] * size + values[position + 1]]++;
+                sumProducts += static_cast<double>(values[position]) * values[position + 1];
+            }
+
+            // Equal values are never adjacent, so only the off-diagonal pairs are counted
+            std::vector<unsigned long long> offDiagonal;
+            for (int first = 0; first < size; first++)
+            {
+                for (int second = 0; second < size; second++)
+                {
+                    if (first != second)
+                        offDiagonal.push_back(counts[first * size + second]);
+                }
+            }
+            const double pairs = static_cast<double>(shuffles);
+            const double statistic = chiSquare(offDiagonal, pairs / (size * (size - 1.0)));
+            report("adjacent pairs, n = " + std::to_string(size), statistic, size * (size - 1.0) - 1.0);
+
+            // Correlation of neighbouring values, -1 / (n - 1) for a uniform shuffle
+            const double mean = (size - 1) / 2.0;
+            const double variance = (size * size - 1.0) / 12.0;
+            const double correlation = (sumProducts / pairs - mean * mean) / variance;
+            std::cout << "    adjacent value correlation " << correlation << " (expected " <<
+                -1.0 / (size - 1) << ")\n";
+        }
+
+        /**
+         * @brief Returns the lexicographic rank of a permutation of 0 to size - 1 (Lehmer code)
+         */
+        static int permutationRank(const std::vector<int>& values)
+        {
+            int rank = 0;
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                int smallerAfter = 0;
+                for (size_t j = i + 1; j < values.size(); j++)
+                {
+                    if (values[j] < values[i])
+                        smallerAfter++;
+                }
+                rank = rank * static_cast<int>(values.size() - i) + smallerAfter;
+            }
+            return rank;
+        }
+
+        double mScale; /**<@brief Scale applied to the number of shuffles */
+        int mTestFailures = 0; /**<@brief Number of failed tests */
+};
+
+template <class Rng>
+Shuffler knuthShuffler(std::uint64_t seed)
+{
+    auto randomGenerator = std::make_shared<Rng>();
+    randomGenerator->seed(seed);
+    return [randomGenerator](std::vector<int>& values) { doc::knuthShuffle(values, *randomGenerator); };
+}
+
+/**
+ * @brief The naive shuffle knuthShuffle used to be, which is biased
+ */
+Shuffler naiveShuffler(std::uint64_t seed)
+{
+    auto randomGenerator = std::make_shared<std::mt19937>(static_cast<std::mt19937::result_type>(seed));
+    return [randomGenerator](std::vector<int>& values)
+    {
+        std::uniform_int_distribution<size_t> dist(0, values.size() - 1);
+        for (auto& value : values)
+            std::swap(value, values[dist(*randomGenerator)]);
+    };
+}
+
+/**
+ * @brief Shuffles with Deck::shuffle()
+ */
+Shuffler deckShuffler(std::uint64_t seed)
+{
+    auto deck = std::make_shared<doc::Deck<int, doc::Xoshiro256StarStar>>();
+    deck->seed(seed);
+    return [deck](std::vector<int>& values)
+    {
+        deck->assign(values);
+        deck->shuffle();
+        values = deck->contents();
+    };
+}
+
+/**
+ * @brief Shuffles with a lazy Deck::shuffle(), dealing the top 3 cards and reading the rest with contents()
+ */
+Shuffler lazyDeckShuffler(std::uint64_t seed)
+{
+    auto deck = std::make_shared<doc::Deck<int, doc::Xoshiro256StarStar>>();
+    deck->seed(seed);
+    deck->setShuffleMode(doc::ShuffleMode::Lazy);
+    return [deck](std::vector<int>& values)
+    {
+        deck->assign(values);
+        deck->shuffle();
+        int top[3];
+        for (auto& card : top)
+            card = deck->deal_card();
+        values = deck->contents();
+        for (int i = 2; i >= 0; i--)
+            values.push_back(top[i]);
+    };
+}
+
+/**
+ * @brief Shuffles with Deck::shuffle(ParallelPolicy), split into three blocks. The blocks and buckets are run on
+ * the calling thread, as the result does not depend on the threads that run them.
+ */
+Shuffler parallelDeckShuffler(std::uint64_t seed)
+{
+    auto deck = std::make_shared<doc::Deck<int, doc::Xoshiro256StarStar>>();
+    auto pool = std::make_shared<doc::ThreadPool>(1);
+    deck->seed(seed);
+    return [deck, pool](std::vector<int>& values)
+    {
+        deck->assign(values);
+        deck->shuffle(doc::ParallelPolicy{3, pool.get(), 0});
+        values = deck->contents();
+    };
+}
+
+/**
+ * @brief Shuffles by dealing every card of a one deck Shoe, which shuffles as it deals
+ */
+Shuffler shoeShuffler(std::uint64_t seed)
+{
+    std::shared_ptr<doc::Shoe<int, doc::Xoshiro256StarStar>> shoe;
+    return [shoe, seed](std::vector<int>& values) mutable
+    {
+        if (!shoe || shoe->capacity() != values.size())
+        {
+            shoe = std::make_shared<doc::Shoe<int, doc::Xoshiro256StarStar>>(values, 1);
+            shoe->seed(seed++);
+        }
+        shoe->shuffle();
+        for (auto& value : values)
+            value = shoe->deal_card();
+    };
+}
+
+/**
+ * @brief Runs the position-by-value test on DeckBatch, which shuffles many decks at once
+ */
+void testDeckBatch(QualityTester& tester, double scale)
+{
+    std::cout << "shuffleBatch with BatchRng:\n";
+    const int size = 10;
+    const std::size_t decksPerBatch = 100000;
+    const unsigned long long batches = std::max(1ULL, static_cast<unsigned long long>(10 * scale));
+
+    std::vector<unsigned long long> counts(size * size, 0);
+    doc::BatchRng randomGenerator(11);
+    doc::DeckBatch batch(decksPerBatch, size);
+    for (unsigned long long i = 0; i < batches; i++)
+    {
+        batch.reset();
+        doc::shuffleBatch(batch, randomGenerator);
+        for (std::size_t deck = 0; deck < decksPerBatch; deck++)
+        {
+            for (int position = 0; position < size; position++)
+                counts[position * size + batch.card(deck, position)]++;
+        }
+    }
+    tester.checkPositionMatrix(counts, size, batches * decksPerBatch);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const double scale = argc > 1 ? std::atof(argv[1]) : 1.0;
+    QualityTester tester(scale);
+
+    tester.testShuffle("knuthShuffle with std::mt19937", knuthShuffler<std::mt19937>(1));
+    tester.testShuffle("knuthShuffle with SplitMix64", knuthShuffler<doc::SplitMix64>(2));
+    tester.testShuffle("knuthShuffle with Xoshiro256StarStar", knuthShuffler<doc::Xoshiro256StarStar>(3));
+    tester.testShuffle("knuthShuffle with Pcg32", knuthShuffler<doc::Pcg32>(4));
+    tester.testShuffle("Deck::shuffle", deckShuffler(5));
+    tester.testShuffle("Deck::shuffle, lazy", lazyDeckShuffler(8));
+    tester.testShuffle("Deck::shuffle, parallel", parallelDeckShuffler(9));
+    tester.testShuffle("Shoe::deal_card", shoeShuffler(7));
+    testDeckBatch(tester, scale);
+    tester.testShuffle("naive shuffle (known to be biased)", naiveShuffler(6), true);
+
+    std::cout << (tester.passed() ? "All shuffle quality tests passed\n" : "Shuffle quality tests FAILED\n");
+    return tester.passed() ? 0 : 1;
+}
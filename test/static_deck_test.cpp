@@ -0,0 +1,176 @@
+/**
+ * @file static_deck_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for StaticPile, StaticDeck and StaticWarCardGame
+ *
+ * This script checks that a standard deck can be built at compile time, that StaticDeck shuffles and deals
+ * exactly as a Deck with the same generator does, that a full StaticPile throws, and that a StaticWarCardGame
+ * plays exactly as a SilentWarCardGame with the same seed. Global operator new is replaced to count
+ * allocations, to check a StaticWarCardGame is built and played without going to the heap.
+ */
+
+#include "compact_card.h"
+#include "deck.h"
+#include "playing_card.h"
+#include "random_engines.h"
+#include "static_deck.h"
+#include "test_check.h"
+#include "war_card_game.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+std::size_t globalAllocations = 0; /**<@brief Calls to the global operator new */
+
+constexpr std::array<doc::CompactCard, 52> kStandardCards = doc::buildStandardDeckArray<doc::CompactCard>();
+constexpr doc::StaticPile<doc::CompactCard, 52> kStandardPile(kStandardCards);
+
+static_assert(kStandardPile.size() == 52 && kStandardPile.back() == kStandardCards[51],
+        "a standard pile is built at compile time");
+
+/**
+ * @brief Returns true if throwing() throws std::length_error
+ */
+template <class Throwing>
+bool throwsLengthError(Throwing throwing)
+{
+    try
+    {
+        throwing();
+    }
+    catch (const std::length_error&)
+    {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+// Count every allocation from the global heap
+void* operator new(std::size_t size)
+{
+    globalAllocations++;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// std::pmr::new_delete_resource() allocates with the aligned form
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    globalAllocations++;
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+int main(int argc, char** argv)
+{
+    const std::vector<doc::PlayingCard> standard = doc::buildStandardDeck();
+    const std::array<doc::PlayingCard, 52> standardArray = doc::buildStandardDeckArray();
+    bool sameOrder = true;
+    for (std::size_t i = 0; i < standard.size(); i++)
+        sameOrder = sameOrder && standard[i].suite() == standardArray[i].suite() &&
+            standard[i].rank() == standardArray[i].rank();
+    check(sameOrder, "buildStandardDeckArray() matches buildStandardDeck()");
+
+    // A StaticDeck shuffles exactly as a Deck with the same generator and seed
+    doc::StaticDeck<doc::CompactCard, 52> staticDeck(kStandardCards);
+    doc::Deck<doc::CompactCard, doc::Xoshiro256StarStar> deck(kStandardCards);
+    staticDeck.seed(11);
+    deck.seed(11);
+    staticDeck.shuffle();
+    deck.shuffle();
+    check(staticDeck.contents() == deck.contents(), "StaticDeck shuffles as Deck does");
+
+    std::vector<doc::CompactCard> dealt;
+    while (!staticDeck.empty())
+        dealt.push_back(staticDeck.deal_card());
+    std::sort(dealt.begin(), dealt.end(), [](doc::CompactCard a, doc::CompactCard b) { return a.id() < b.id(); });
+    bool everyCard = dealt.size() == 52;
+    for (std::size_t i = 0; everyCard && i < dealt.size(); i++)
+        everyCard = dealt[i].id() == i;
+    check(everyCard, "StaticDeck deals every card once");
+
+    staticDeck.assign(std::vector<doc::CompactCard>(kStandardCards.begin(), kStandardCards.begin() + 10));
+    staticDeck.setShuffleMode(doc::ShuffleMode::Lazy);
+    staticDeck.shuffle();
+    staticDeck.emplace_bottom(kStandardCards[20]);
+    check(staticDeck.size() == 11 && staticDeck.contents().front() == kStandardCards[20],
+            "StaticDeck assigns, shuffles lazily and adds to the bottom");
+    // 52 cards, their pile's bounds, the generator and the deck's saved random bits
+    check(sizeof(doc::StaticDeck<doc::CompactCard, 52>) <= 128, "StaticDeck stores its cards inline");
+
+    doc::StaticPile<doc::CompactCard, 4> small;
+    check(throwsLengthError([&]() { small.assign(kStandardCards.begin(), kStandardCards.begin() + 5); }) &&
+            throwsLengthError([&]() { small.reserve(5); }), "a StaticPile throws when over capacity");
+
+    // A StaticWarCardGame plays exactly as a SilentWarCardGame with the same seed
+    bool samePlay = true;
+    for (std::uint64_t seed = 0; seed < 20; seed++)
+    {
+        doc::StaticWarCardGame<> staticGame(standard, seed);
+        doc::SilentWarCardGame game(standard, seed);
+        staticGame.autoPlay();
+        game.autoPlay();
+        samePlay = samePlay && staticGame.snapshot() == game.snapshot();
+    }
+    check(samePlay, "StaticWarCardGame plays as SilentWarCardGame does");
+
+    // Building and playing a StaticWarCardGame, with either win pile rule, never allocates
+    const std::size_t beforeGames = globalAllocations;
+    doc::StaticWarCardGame<> shuffled(standard, 5);
+    shuffled.autoPlay();
+    doc::StaticWarCardGame<> unshuffled(standard, 5);
+    unshuffled.setWinPileRule(doc::WinPileRule::NoShuffle);
+    unshuffled.setTurnCap(100000);
+    unshuffled.autoPlay();
+    const std::size_t gameAllocations = globalAllocations - beforeGames;
+    std::cout << "  " << gameAllocations << " global allocations\n";
+    check(gameAllocations == 0 && shuffled.gameOver() && unshuffled.gameOver(),
+            "StaticWarCardGame makes no heap allocations");
+
+    std::vector<doc::PlayingCard> twoDecks(standard);
+    twoDecks.insert(twoDecks.end(), standard.begin(), standard.end());
+    doc::StaticWarCardGame<104> bigGame(twoDecks, 3);
+    bigGame.autoPlay();
+    check(bigGame.gameOver(), "StaticWarCardGame plays a two deck game");
+    check(throwsLengthError([&]() { doc::StaticWarCardGame<> tooSmall(twoDecks, 3); }),
+            "StaticWarCardGame throws if it cannot hold the cards");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file statistics_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the streaming statistics accumulators and WarSimulator's summary mode
+ *
+ * This script checks RunningStats against a two-pass mean and variance, and that merged accumulators, histograms
+ * and quantile sketches match ones that saw every value. It checks sketch quantiles are within their relative
+ * accuracy of the exact quantiles, and that WarSimulator::summarize() agrees with run() for any number of
+ * threads and writes CSV and JSON.
+ */
+
+#include "statistics.h"
+#include "test_check.h"
+#include "war_simulator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+bool near(double a, double b, double tolerance)
+{
+    return std::fabs(a - b) <= tolerance * std::max(1.0, std::fabs(b));
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // Heavy tailed values, like game lengths
+    std::mt19937_64 engine(1);
+    std::lognormal_distribution<double> lengths(6.0, 1.0);
+    std::vector<std::uint64_t> values(100000);
+    for (auto& value : values)
+        value = static_cast<std::uint64_t>(lengths(engine));
+
+    double sum = 0.0;
+    for (const auto value : values)
+        sum += value;
+    const double mean = sum / values.size();
+    double squares = 0.0;
+    for (const auto value : values)
+        squares += (value - mean) * (value - mean);
+    const double variance = squares / (values.size() - 1);
+
+    doc::Distribution all;
+    doc::Distribution firstHalf;
+    doc::Distribution secondHalf;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        all.add(values[i]);
+        (i < values.size() / 3 ? firstHalf : secondHalf).add(values[i]);
+    }
+    check(all.stats().count() == values.size() && near(all.stats().mean(), mean, 1e-12) &&
+            near(all.stats().variance(), variance, 1e-9) &&
+            all.stats().min() == *std::min_element(values.begin(), values.end()) &&
+            all.stats().max() == *std::max_element(values.begin(), values.end()),
+            "RunningStats matches a two-pass mean and variance");
+
+    firstHalf.merge(secondHalf);
+    bool sameHistogram = true;
+    for (int bucket = 0; bucket < doc::LogHistogram::kBuckets; bucket++)
+        sameHistogram = sameHistogram && firstHalf.histogram().count(bucket) == all.histogram().count(bucket);
+    check(firstHalf.stats().count() == all.stats().count() && near(firstHalf.stats().mean(), mean, 1e-12) &&
+            near(firstHalf.stats().variance(), variance, 1e-9) && firstHalf.stats().max() == all.stats().max(),
+            "merged RunningStats match one that saw every value");
+    check(sameHistogram && all.histogram().total() == values.size(), "merged histograms match");
+    check(firstHalf.quantiles().quantile(0.5) == all.quantiles().quantile(0.5) &&
+            firstHalf.quantiles().quantile(0.99) == all.quantiles().quantile(0.99), "merged sketches match");
+
+    check(doc::LogHistogram::bucketOf(0) == 0 && doc::LogHistogram::bucketOf(1) == 1 &&
+            doc::LogHistogram::bucketOf(7) == 3 && doc::LogHistogram::bucketOf(8) == 4 &&
+            doc::LogHistogram::bucketMin(4) == 8 && doc::LogHistogram::bucketMax(4) == 15 &&
+            doc::LogHistogram::bucketOf(UINT64_MAX) == 64 && doc::LogHistogram::bucketMax(64) == UINT64_MAX,
+            "histogram buckets are powers of two");
+
+    // Quantiles are within the sketch's relative accuracy of the exact quantiles
+    std::vector<std::uint64_t> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    bool accurate = true;
+    for (const double q : {0.01, 0.1, 0.5, 0.9, 0.99, 0.999})
+    {
+        const double exact = static_cast<double>(sorted[static_cast<std::size_t>(q * (sorted.size() - 1))]);
+        accurate = accurate && near(all.quantiles().quantile(q), exact, 0.01 + 1e-9);
+    }
+    check(accurate, "sketch quantiles are within 1% of the exact quantiles");
+
+    bool threw = false;
+    try
+    {
+        doc::QuantileSketch coarse(0.05);
+        doc::QuantileSketch fine(0.01);
+        fine.merge(coarse);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check(threw, "sketches with different accuracies do not merge");
+
+    // Summary mode agrees with the per-game results, whatever the number of threads
+    const doc::WarSimulator simulator;
+    const doc::WarSimulationResult result = simulator.run(2000, 1, 5);
+    const doc::WarStats oneThread = simulator.summarize(2000, 1, 5);
+    const doc::WarStats fourThreads = simulator.summarize(2000, 4, 5);
+    unsigned long long longestWar = 0;
+    for (const auto& game : result.games)
+        longestWar = std::max(longestWar, game.longestWar);
+    check(oneThread.games() == 2000 && oneThread.playerOneWins() == result.playerOneWins &&
+            oneThread.playerTwoWins() == result.playerTwoWins &&
+            near(oneThread.turns().stats().mean(), static_cast<double>(result.totalTurns) / 2000, 1e-12) &&
+            near(oneThread.wars().stats().mean(), static_cast<double>(result.totalWars) / 2000, 1e-12) &&
+            oneThread.longestWar().stats().max() == longestWar && longestWar > 0,
+            "summarize() agrees with run()");
+
+    bool sameBuckets = true;
+    for (int bucket = 0; bucket < doc::LogHistogram::kBuckets; bucket++)
+    {
+        sameBuckets = sameBuckets &&
+            oneThread.turns().histogram().count(bucket) == fourThreads.turns().histogram().count(bucket) &&
+            oneThread.reshuffles().histogram().count(bucket) == fourThreads.reshuffles().histogram().count(bucket);
+    }
+    check(sameBuckets && fourThreads.playerOneWins() == oneThread.playerOneWins() &&
+            fourThreads.turns().quantiles().quantile(0.9) == oneThread.turns().quantiles().quantile(0.9) &&
+            near(fourThreads.turns().stats().mean(), oneThread.turns().stats().mean(), 1e-12),
+            "summaries do not depend on the number of threads");
+
+    std::ostringstream csv;
+    std::ostringstream json;
+    oneThread.writeCsv(csv);
+    oneThread.writeJson(json);
+    check(csv.str().find("metric,statistic,value\n") == 0 && csv.str().find("\nturns,p99,") != std::string::npos &&
+            csv.str().find("\ngames,count,2000\n") != std::string::npos, "summary writes CSV");
+    check(json.str().find("{\"games\": 2000") == 0 && json.str().find("\"longest_war\": {") != std::string::npos &&
+            json.str().find("\"histogram\": [{") != std::string::npos, "summary writes JSON");
+
+    return failures == 0 ? 0 : 1;
+}
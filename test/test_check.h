@@ -0,0 +1,35 @@
+/**
+ * @file test_check.h
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Declare the check() helper and failure count shared by the test scripts
+ *
+ * Each test script is one source file that includes this header once, prints a line per check, and returns
+ * failures == 0 ? 0 : 1 from main.
+ */
+
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <iostream>
+
+namespace
+{
+
+int failures = 0; /**<@brief Checks that failed so far */
+
+/**
+ * @brief Prints whether a check passed, counting it in failures if not
+ */
+void check(bool passed, const char* description)
+{
+    std::cout << (passed ? "passed: " : "FAILED: ") << description << "\n";
+    if (!passed)
+        failures++;
+}
+
+} // namespace
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file trace_writer_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for allocation-free card formatting, TraceWriter and TraceWarSink
+ *
+ * This script checks that formatTo() and the name tables match str() and toString() for every card, that a
+ * game traced with TraceWarSink writes exactly what TextWarSink prints, that records from many threads are
+ * written whole, in order within each thread, and with fewer writes than buffers' worth of records, and that
+ * a failed write is reported by flush().
+ */
+
+#include "playing_card.h"
+#include "test_check.h"
+#include "trace_writer.h"
+#include "war_card_game.h"
+#include "war_event_sink.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+static_assert(doc::PlayingCard::name(doc::PlayingCard::Rank::Ten) == "10" &&
+        doc::PlayingCard::name(doc::PlayingCard::Suite::Diamonds) == "Diamonds", "names are constexpr");
+
+std::string readFile(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    return contents.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bool formatted = true;
+    for (const auto& card : doc::buildStandardDeck())
+    {
+        char buffer[doc::PlayingCard::kMaxFormattedLength];
+        const std::size_t length = card.formatTo(buffer);
+        formatted = formatted && std::string(buffer, length) == card.str() &&
+            doc::PlayingCard::toString(card.rank()) == doc::PlayingCard::name(card.rank()) &&
+            doc::PlayingCard::toString(card.suite()) == doc::PlayingCard::name(card.suite());
+    }
+    check(formatted, "formatTo() and the name tables match str() and toString()");
+
+    const std::string path = "trace_writer_test.txt";
+
+    // A traced game writes exactly what TextWarSink prints
+    std::ostringstream printed;
+    doc::WarCardGame printedGame(doc::buildStandardDeck(), 8, doc::TextWarSink(printed));
+    printedGame.autoPlay();
+    {
+        doc::TraceWriter writer(path, 4096);
+        {
+            doc::BasicWarCardGame<doc::TraceWarSink> tracedGame(doc::buildStandardDeck(), 8,
+                    doc::TraceWarSink(writer));
+            tracedGame.autoPlay();
+        }
+        writer.flush();
+        check(writer.writes() < writer.bytesWritten() / 1000, "records are written in large batches");
+    }
+    check(readFile(path) == printed.str(), "TraceWarSink writes what TextWarSink prints");
+
+    // Records from many threads are written whole, and in order within each thread
+    const int threads = 4;
+    const int records = 20000;
+    {
+        doc::TraceWriter writer(path, 1000, 2);
+        std::vector<std::thread> pool;
+        for (int thread = 0; thread < threads; thread++)
+        {
+            pool.emplace_back([&writer, thread]()
+            {
+                doc::TraceWriter::Channel channel = writer.channel();
+                for (int record = 0; record < records; record++)
+                    channel.append(std::to_string(thread) + " " + std::to_string(record) + "\n");
+            });
+        }
+        for (auto& thread : pool)
+            thread.join();
+        writer.flush();
+    }
+    std::istringstream lines(readFile(path));
+    std::vector<int> next(threads, 0);
+    bool inOrder = true;
+    int thread = 0;
+    int record = 0;
+    while (lines >> thread >> record)
+    {
+        inOrder = inOrder && thread >= 0 && thread < threads && record == next[thread];
+        if (thread >= 0 && thread < threads)
+            next[thread]++;
+    }
+    check(inOrder && std::all_of(next.begin(), next.end(), [](int count) { return count == records; }),
+            "records from many threads are written whole and in order");
+    std::remove(path.c_str());
+
+    // A failed write is reported
+    bool threw = false;
+    {
+        doc::TraceWriter writer(-1, 64);
+        writer.channel().append("lost\n");
+        try
+        {
+            writer.flush();
+        }
+        catch (const std::system_error&)
+        {
+            threw = true;
+        }
+    }
+    check(threw, "a failed write is reported by flush()");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file war_cycle_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for WarCardGame cycle detection and turn cap
+ *
+ * This script plays games without shuffling win piles, which often repeat forever, and checks every game
+ * ends with a winner or a cycle. For games that cycled, it replays the game and checks the position really
+ * does repeat after the cycle length. It also checks the turn cap stops a game, and that games with shuffling
+ * are never reported as cycles.
+ */
+
+#include "playing_card.h"
+#include "test_check.h"
+#include "war_card_game.h"
+#include "war_simulator.h"
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Returns the cards and rules of a game's snapshot, without its counters
+ */
+std::vector<std::uint8_t> positionOf(const doc::SilentWarCardGame& game)
+{
+    const std::vector<std::uint8_t> snapshot = game.snapshot();
+    const std::size_t counters = 4 + 4 + 3 * 8; // magic, version, turns, wars and reshuffles
+    const std::size_t stopStart = counters + 1 + 8; // stopped outcome and cycle length follow rule and turn cap
+    const std::size_t stopEnd = stopStart + 1 + 8;
+    std::vector<std::uint8_t> position;
+    for (std::size_t i = counters; i < snapshot.size(); i++)
+    {
+        if (i < stopStart || i >= stopEnd)
+            position.push_back(snapshot[i]);
+    }
+    return position;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::vector<doc::PlayingCard> cards = doc::buildStandardDeck();
+
+    doc::WarSimulator simulator(cards);
+    simulator.setWinPileRule(doc::WinPileRule::NoShuffle);
+    const doc::WarSimulationResult result = simulator.run(500, 1, 3);
+    check(result.playerOneWins + result.playerTwoWins + result.cycles == 500 && result.capped == 0,
+            "every game without shuffling ends with a winner or a cycle");
+    check(result.cycles > 0, "some games without shuffling cycle");
+
+    // Replay cycled games, and check the position repeats after the cycle length
+    bool repeats = true;
+    int checked = 0;
+    for (unsigned long long index = 0; index < result.games.size() && checked < 20; index++)
+    {
+        if (result.games[index].outcome != doc::WarOutcome::Cycle)
+            continue;
+        doc::SilentWarCardGame cycled(cards, doc::WarSimulator::gameSeed(3, index));
+        cycled.setWinPileRule(doc::WinPileRule::NoShuffle);
+        while (!cycled.gameOver())
+            cycled.playTurn();
+
+        doc::SilentWarCardGame replay(cards, doc::WarSimulator::gameSeed(3, index));
+        replay.setWinPileRule(doc::WinPileRule::NoShuffle);
+        while (replay.turnsPlayed() < cycled.turnsPlayed() - cycled.cycleLength())
+            replay.playTurn();
+        const std::vector<std::uint8_t> before = positionOf(replay);
+        for (unsigned long long turn = 0; turn < cycled.cycleLength(); turn++)
+            replay.playTurn();
+        repeats = repeats && cycled.outcome() == doc::WarOutcome::Cycle && cycled.winner() == 0 &&
+            cycled.cycleLength() > 0 && positionOf(replay) == before;
+        checked++;
+    }
+    check(checked > 0 && repeats, "the position of a cycled game repeats after the cycle length");
+
+    doc::SilentWarCardGame capped(cards, 11);
+    capped.setTurnCap(10);
+    while (!capped.gameOver())
+        capped.playTurn();
+    check(capped.outcome() == doc::WarOutcome::Capped && capped.turnsPlayed() == 10 && capped.winner() == 0,
+            "the turn cap stops the game");
+
+    // autoPlay counts each turn once, so it stops at the cap and agrees with playing turn by turn
+    doc::SilentWarCardGame autoCapped(cards, 11);
+    autoCapped.setTurnCap(100);
+    autoCapped.autoPlay();
+    check(autoCapped.outcome() == doc::WarOutcome::Capped && autoCapped.turnsPlayed() == 100,
+            "autoPlay stops at exactly the turn cap");
+    doc::SilentWarCardGame automatic(cards, 12);
+    doc::SilentWarCardGame manual(cards, 12);
+    automatic.autoPlay();
+    while (!manual.gameOver())
+        manual.playTurn();
+    check(automatic.turnsPlayed() == manual.turnsPlayed() && automatic.snapshot() == manual.snapshot(),
+            "autoPlay plays the same turns as playTurn");
+
+    doc::WarSimulator shuffled(cards);
+    shuffled.setTurnCap(100000);
+    const doc::WarSimulationResult shuffledResult = shuffled.run(200, 1, 4);
+    check(shuffledResult.cycles == 0 && shuffledResult.capped == 0 &&
+            shuffledResult.playerOneWins + shuffledResult.playerTwoWins == 200,
+            "games with shuffling end with a winner");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file war_game_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the N-player WarGame class
+ *
+ * This script plays seeded games of 2 to 8 players and checks, after every turn, that no cards are lost or
+ * made, that eliminated players hold no cards, and that the winner ends with every card. It checks multi-way
+ * draws with decks of few ranks, where the players in a war that everyone runs out of keep their cards and
+ * win those of the players who lost the turn; that a deck of one rank, where no turn can be won, ends in a
+ * stalemate; and that seeded games are played identically.
+ */
+
+#include "playing_card.h"
+#include "test_check.h"
+#include "war_game.h"
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Plays seeded games to the end, checking the cards and players after every turn
+ */
+template <std::size_t NPlayers>
+void checkGames(const std::vector<doc::PlayingCard>& cards, int games)
+{
+    const std::size_t total = cards.size() - cards.size() % NPlayers;
+    bool conserved = true;
+    bool eliminated = true;
+    bool won = true;
+    unsigned long long wars = 0;
+    for (int seed = 0; seed < games; seed++)
+    {
+        doc::WarGame<NPlayers> game(cards, seed);
+        game.setTurnCap(1000000);
+        while (!game.gameOver())
+        {
+            game.playTurn();
+            std::size_t held = 0;
+            int left = 0;
+            for (int player = 1; player <= static_cast<int>(NPlayers); player++)
+            {
+                held += game.cardCount(player);
+                const bool out = game.eliminatedOnTurn(player) != 0;
+                left += out ? 0 : 1;
+                eliminated = eliminated && (!out || game.cardCount(player) == 0);
+            }
+            conserved = conserved && held == total;
+            eliminated = eliminated && left == game.playersLeft();
+        }
+        won = won && !game.capped() && game.winner() != 0 && game.cardCount(game.winner()) == total &&
+            game.playersLeft() == 1;
+        wars += game.warsPlayed();
+    }
+
+    const std::string players = std::to_string(NPlayers) + " players: ";
+    check(conserved, (players + "no cards are lost or made").c_str());
+    check(eliminated, (players + "eliminated players hold no cards").c_str());
+    check(won, (players + "every game ends with a winner holding every card").c_str());
+    check(wars > 0, (players + "wars are played").c_str());
+}
+
+/**
+ * @brief Plays seeded games with a deck of mostly one rank, so most wars are drawn, and checks no cards are
+ * lost or made and every game ends with a winner or a stalemate
+ */
+template <std::size_t NPlayers>
+void checkDraws(const std::vector<doc::PlayingCard>& cards, int games)
+{
+    bool conserved = true;
+    bool ended = true;
+    for (int seed = 0; seed < games; seed++)
+    {
+        doc::WarGame<NPlayers> game(cards, seed);
+        game.setTurnCap(1000000);
+        while (!game.gameOver())
+        {
+            game.playTurn();
+            std::size_t held = 0;
+            for (int player = 1; player <= static_cast<int>(NPlayers); player++)
+                held += game.cardCount(player);
+            conserved = conserved && held == cards.size();
+        }
+        ended = ended && !game.capped() && (game.winner() != 0 || game.stalemate());
+    }
+
+    const std::string players = std::to_string(NPlayers) + " players: ";
+    check(conserved, (players + "no cards are lost or made in drawn wars").c_str());
+    check(ended, (players + "games with drawn wars end with a winner or a stalemate").c_str());
+}
+
+std::vector<doc::PlayingCard> ofRanks(std::initializer_list<std::pair<doc::PlayingCard::Rank, int>> ranks)
+{
+    std::vector<doc::PlayingCard> cards;
+    for (const auto& [rank, count] : ranks)
+    {
+        for (int i = 0; i < count; i++)
+            cards.push_back(doc::PlayingCard(static_cast<doc::PlayingCard::Suite>(i % 4), rank));
+    }
+    return cards;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::vector<doc::PlayingCard> cards = doc::buildStandardDeck();
+
+    checkGames<2>(cards, 200);
+    checkGames<3>(cards, 200);
+    checkGames<4>(cards, 200);
+    checkGames<5>(cards, 100);
+    checkGames<6>(cards, 100);
+    checkGames<7>(cards, 100);
+    checkGames<8>(cards, 100);
+
+    // 52 cards between 5 players drops 2 cards
+    doc::WarGame<5> five(cards, 1);
+    check(five.cardCount(1) == 10 && five.cardCount(5) == 10 && five.playersLeft() == 5,
+            "cards that do not divide evenly are dropped");
+
+    using Rank = doc::PlayingCard::Rank;
+    checkDraws<3>(ofRanks({{Rank::Ace, 4}, {Rank::Two, 2}}), 200);
+    checkDraws<3>(ofRanks({{Rank::Ace, 6}, {Rank::Two, 3}}), 200);
+    checkDraws<4>(ofRanks({{Rank::Ace, 8}, {Rank::King, 4}, {Rank::Two, 4}}), 200);
+
+    // Two cards each: when two players show aces and the third a two, the aces tie and both run out in the war,
+    // so they keep their cards and the player who showed the two loses it to one of them
+    const std::vector<doc::PlayingCard> twos = ofRanks({{Rank::Ace, 4}, {Rank::Two, 2}});
+    bool drawn = false;
+    for (int seed = 0; seed < 100 && !drawn; seed++)
+    {
+        doc::WarGame<3> game(twos, seed);
+        game.playTurn();
+        for (int loser = 1; loser <= 3; loser++)
+        {
+            const std::size_t first = game.cardCount(loser % 3 + 1);
+            const std::size_t second = game.cardCount((loser + 1) % 3 + 1);
+            drawn = drawn || (game.cardCount(loser) == 1 && first + second == 5 && first >= 2 && second >= 2 &&
+                game.warsPlayed() == 1);
+        }
+    }
+    check(drawn, "players who lose a drawn turn lose their cards to the players in the war");
+
+    // With cards of one rank every player ties, every war ties until all run out, and no turn can be won
+    doc::WarGame<4> tied(ofRanks({{Rank::Ace, 16}}), 2);
+    tied.autoPlay();
+    check(tied.stalemate() && !tied.capped() && tied.winner() == 0 && tied.turnsPlayed() == 1 &&
+            tied.warsPlayed() == 2 && tied.cardCount(1) == 4 && tied.cardCount(4) == 4,
+            "a war every player runs out of is a draw, and a stalemate with cards of one rank");
+
+    // Seeded games are played identically
+    doc::WarGame<6> first(cards, 3);
+    doc::WarGame<6> second(cards, 3);
+    first.autoPlay();
+    second.autoPlay();
+    check(first.turnsPlayed() == second.turnsPlayed() && first.warsPlayed() == second.warsPlayed() &&
+            first.winner() == second.winner() && first.eliminatedOnTurn(1) == second.eliminatedOnTurn(1),
+            "games with the same seed are played identically");
+
+    return failures == 0 ? 0 : 1;
+}
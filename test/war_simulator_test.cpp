@@ -0,0 +1,75 @@
+/**
+ * @file war_simulator_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the WarSimulator class
+ *
+ * This script plays the same batch of games with one worker thread and with several, checks that both
+ * batches produce the same results, and prints the totals and the time each batch took.
+ */
+
+#include "war_simulator.h"
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+
+doc::WarSimulationResult timedRun(const doc::WarSimulator& simulator, unsigned long long games,
+        unsigned int threads, std::uint64_t seed)
+{
+    const auto start = std::chrono::steady_clock::now();
+    doc::WarSimulationResult result = simulator.run(games, threads, seed);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << games << " games on " << threads << " thread(s) took " << elapsed.count() << " s\n";
+    std::cout << "  turns: " << result.totalTurns << "  wars: " << result.totalWars <<
+        "  reshuffles: " << result.totalReshuffles << "\n";
+    std::cout << "  Player One won " << result.playerOneWins << "  Player Two won " <<
+        result.playerTwoWins << "\n";
+    return result;
+}
+
+bool sameResults(const doc::WarSimulationResult& first, const doc::WarSimulationResult& second)
+{
+    if (first.games.size() != second.games.size())
+        return false;
+    for (size_t i = 0; i < first.games.size(); i++)
+    {
+        const doc::WarGameResult& a = first.games[i];
+        const doc::WarGameResult& b = second.games[i];
+        if (a.turns != b.turns || a.wars != b.wars || a.reshuffles != b.reshuffles || a.winner != b.winner)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const unsigned long long games = 20000;
+    const std::uint64_t seed = 2022;
+    const doc::WarSimulator simulator;
+
+    const doc::WarSimulationResult single = timedRun(simulator, games, 1, seed);
+    const doc::WarSimulationResult pooled = timedRun(simulator, games, 4, seed);
+
+    if (!sameResults(single, pooled))
+    {
+        std::cout << "FAILED: results depend on the number of threads\n";
+        return 1;
+    }
+
+    if (single.playerOneWins + single.playerTwoWins != games)
+    {
+        std::cout << "FAILED: not every game finished with a winner\n";
+        return 1;
+    }
+
+    std::cout << "Results are identical for any number of threads\n";
+    return 0;
+}
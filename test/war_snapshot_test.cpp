@@ -0,0 +1,120 @@
+/**
+ * @file war_snapshot_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for WarCardGame snapshots and replay
+ *
+ * This script snapshots a seeded game part way through, restores it into another game, and checks both
+ * games play on identically. It checks replayWarGame() re-creates a game at a turn, including into a
+ * WarCardGame that prints and with the win pile rule, turn cap and piles the game was played with, and that
+ * invalid snapshots are rejected without changing the game.
+ */
+
+#include "playing_card.h"
+#include "test_check.h"
+#include "war_card_game.h"
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+template <class Game>
+void playTurns(Game& game, int turns)
+{
+    for (int i = 0; i < turns && !game.gameOver(); i++)
+        game.playTurn();
+}
+
+void playToEnd(doc::SilentWarCardGame& game)
+{
+    while (!game.gameOver())
+        game.playTurn();
+}
+
+bool rejects(doc::SilentWarCardGame& game, const std::vector<std::uint8_t>& data)
+{
+    try
+    {
+        game.restore(data);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::vector<doc::PlayingCard> cards = doc::buildStandardDeck();
+
+    doc::SilentWarCardGame original(cards, 42);
+    playTurns(original, 100);
+    const std::vector<std::uint8_t> snapshot = original.snapshot();
+    check(snapshot.size() == 4 + 4 + 3 * 8 + 1 + 8 + 1 + 8 + 8 * 8 + 6 * 4 + 52 && snapshot[0] == 'D' &&
+            snapshot[3] == 'W' && snapshot[4] == doc::SilentWarCardGame::kSnapshotVersion,
+            "snapshot has a header and one byte per card");
+
+    doc::SilentWarCardGame restored(cards, 7);
+    restored.restore(snapshot);
+    check(restored.snapshot() == snapshot && restored.turnsPlayed() == original.turnsPlayed(),
+            "restored game has the snapshot's state");
+
+    playToEnd(original);
+    playToEnd(restored);
+    check(restored.turnsPlayed() == original.turnsPlayed() && restored.warsPlayed() == original.warsPlayed() &&
+            restored.reshuffles() == original.reshuffles() && restored.winner() == original.winner() &&
+            restored.snapshot() == original.snapshot(), "restored game plays on identically");
+
+    // Replay jumps straight to a turn
+    doc::SilentWarCardGame direct(cards, 42);
+    playTurns(direct, 150);
+    doc::SilentWarCardGame replayed = doc::replayWarGame(cards, 42, 150, doc::NullWarSink());
+    check(replayed.turnsPlayed() == 150 && replayed.snapshot() == direct.snapshot(),
+            "replayWarGame re-creates the game at a turn");
+
+    std::ostringstream output;
+    doc::WarCardGame printed = doc::replayWarGame(cards, 42, 150, doc::TextWarSink(output));
+    printed.playTurn();
+    direct.playTurn();
+    check(!output.str().empty() && printed.snapshot() == direct.snapshot(),
+            "replayWarGame into a WarCardGame prints from that turn");
+
+    // Replay plays with the game's win pile rule and turn cap, and with its piles
+    doc::SilentWarCardGame unshuffled(cards, 43);
+    unshuffled.setWinPileRule(doc::WinPileRule::NoShuffle);
+    unshuffled.setTurnCap(1000);
+    playTurns(unshuffled, 150);
+    doc::SilentWarCardGame replayedUnshuffled = doc::replayWarGame(cards, 43, 150, doc::NullWarSink(),
+            doc::WinPileRule::NoShuffle, 1000);
+    check(replayedUnshuffled.snapshot() == unshuffled.snapshot(),
+            "replayWarGame re-creates a NoShuffle game with a turn cap at a turn");
+
+    doc::StaticWarCardGame<> inline52(cards, 44);
+    playTurns(inline52, 150);
+    using InlinePile = doc::StaticPile<doc::CompactCard, 52>;
+    doc::StaticWarCardGame<> replayedInline = doc::replayWarGame<doc::NullWarSink, InlinePile>(cards, 44, 150);
+    check(replayedInline.snapshot() == inline52.snapshot(), "replayWarGame re-creates a StaticWarCardGame at a turn");
+
+    // Invalid snapshots are rejected, leaving the game unchanged
+    const std::vector<std::uint8_t> before = direct.snapshot();
+    std::vector<std::uint8_t> badMagic = snapshot;
+    badMagic[0] = 'X';
+    std::vector<std::uint8_t> badVersion = snapshot;
+    badVersion[4]++;
+    const std::vector<std::uint8_t> truncated(snapshot.begin(), snapshot.end() - 1);
+    std::vector<std::uint8_t> badCard = snapshot;
+    badCard.back() = 52;
+    check(rejects(direct, badMagic) && rejects(direct, badVersion) && rejects(direct, truncated) &&
+            rejects(direct, badCard) && direct.snapshot() == before, "invalid snapshots are rejected");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file war_solver_test.cpp
+ *
+ * @author Channing Ko-Madden
+ *
+ * @date 10/17/2026
+ *
+ * @brief Test script for the exact WarSolver
+ *
+ * This script checks the solver on a two card game it can be checked by hand, that its probabilities add up
+ * and favor neither player, and that decks differing only by suit solve the same. It then plays the same small
+ * decks with WarSimulator and checks the simulated mean game length and short game rate are within a few
+ * standard errors of the exact values.
+ */
+
+#include "playing_card.h"
+#include "test_check.h"
+#include "war_simulator.h"
+#include "war_solver.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+using Suite = doc::PlayingCard::Suite;
+using Rank = doc::PlayingCard::Rank;
+
+/**
+ * @brief Checks WarSimulator's games of a deck against the solver's exact distribution
+ */
+void checkAgainstSimulator(const std::vector<doc::PlayingCard>& cards, const doc::WarDistribution& exact,
+        const char* description)
+{
+    const unsigned long long games = 40000;
+    const unsigned int shortGame = 3;
+    const doc::WarSimulationResult simulated = doc::WarSimulator(cards).run(games, 0, 9);
+
+    double exactShort = 0.0;
+    double secondMoment = 0.0;
+    for (std::size_t length = 0; length < exact.gameLength.size(); length++)
+    {
+        exactShort += length <= shortGame ? exact.gameLength[length] : 0.0;
+        secondMoment += length * static_cast<double>(length) * exact.gameLength[length];
+    }
+    const double mean = exact.meanLength();
+    const double meanError = std::sqrt((secondMoment - mean * mean) / games);
+    const double shortError = std::sqrt(exactShort * (1.0 - exactShort) / games);
+
+    unsigned long long simulatedShort = 0;
+    for (const auto& game : simulated.games)
+        simulatedShort += game.turns <= shortGame ? 1 : 0;
+    const double simulatedMean = static_cast<double>(simulated.totalTurns) / games;
+    const double simulatedShortRate = static_cast<double>(simulatedShort) / games;
+    check(std::fabs(simulatedMean - mean) < 5 * meanError &&
+            std::fabs(simulatedShortRate - exactShort) < 5 * shortError, description);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // Whoever is dealt the Ace wins the first turn and the game
+    doc::WarSolver twoCards({doc::PlayingCard(Suite::Spades, Rank::Ace), doc::PlayingCard(Suite::Hearts, Rank::Two)});
+    const doc::WarDistribution two = twoCards.solve();
+    check(two.gameLength.size() == 2 && two.gameLength[1] == 1.0 && two.playerOneWins == 0.5 &&
+            two.playerTwoWins == 0.5 && two.unresolved == 0.0, "two card game ends in one turn, either player winning");
+
+    const std::vector<doc::PlayingCard> ten = {
+        doc::PlayingCard(Suite::Spades, Rank::Ace), doc::PlayingCard(Suite::Hearts, Rank::Ace),
+        doc::PlayingCard(Suite::Spades, Rank::King), doc::PlayingCard(Suite::Hearts, Rank::King),
+        doc::PlayingCard(Suite::Spades, Rank::Seven), doc::PlayingCard(Suite::Hearts, Rank::Seven),
+        doc::PlayingCard(Suite::Clubs, Rank::Seven), doc::PlayingCard(Suite::Spades, Rank::Three),
+        doc::PlayingCard(Suite::Hearts, Rank::Three), doc::PlayingCard(Suite::Spades, Rank::Two)};
+    doc::WarSolver tenCards(ten);
+    const doc::WarDistribution exact = tenCards.solve();
+    double ended = 0.0;
+    for (const double probability : exact.gameLength)
+        ended += probability;
+    check(std::fabs(exact.playerOneWins + exact.playerTwoWins + exact.unresolved - 1.0) < 1e-9 &&
+            std::fabs(ended - exact.playerOneWins - exact.playerTwoWins) < 1e-9 && exact.unresolved < 1e-11,
+            "probabilities of every outcome add up to 1");
+    check(std::fabs(exact.playerOneWins - exact.playerTwoWins) < 1e-9, "neither player is favored");
+    check(exact.states > 0 && tenCards.solve().meanLength() == exact.meanLength(),
+            "solving again reuses the transposition table and gives the same result");
+
+    // Suits do not matter, so swapping them solves the same
+    std::vector<doc::PlayingCard> otherSuits;
+    for (const auto& card : ten)
+        otherSuits.push_back(doc::PlayingCard(card.suite() == Suite::Spades ? Suite::Diamonds : card.suite(),
+                card.rank()));
+    const doc::WarDistribution swapped = doc::WarSolver(otherSuits).solve();
+    check(swapped.gameLength == exact.gameLength && swapped.states == exact.states,
+            "decks that differ only by suit solve the same");
+
+    checkAgainstSimulator(ten, exact, "simulated ten card games match the exact distribution");
+
+    std::vector<doc::PlayingCard> twelve(ten.begin(), ten.end());
+    twelve.push_back(doc::PlayingCard(Suite::Diamonds, Rank::Two));
+    twelve.push_back(doc::PlayingCard(Suite::Diamonds, Rank::King));
+    checkAgainstSimulator(twelve, doc::WarSolver(twelve).solve(),
+            "simulated twelve card games match the exact distribution");
+
+    bool threw = false;
+    try
+    {
+        doc::WarSolver tooMany(doc::buildStandardDeck());
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    check(threw, "a full deck is too large to solve exactly");
+
+    return failures == 0 ? 0 : 1;
+}